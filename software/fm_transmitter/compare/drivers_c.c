@@ -0,0 +1,42 @@
+// ===================================================================================
+// Driver Size Comparison: C Drivers
+// ===================================================================================
+// Same sequence as drivers_cpp.cpp using the C drivers. Build both with
+// 'make compare', compare their I2C byte streams with 'make compare-host'.
+
+#include <system.h>
+#include <i2c_tx.h>
+#include <ssd1306_txt.h>
+#include <kt0803.h>
+
+const uint8_t BITMAP[] = {
+  0xFC, 0xF9, 0xF3, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF3, 0xF9, 0xFC,
+  0x7F, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x7F
+};
+
+// Driver sequence (also called by host_bus.c)
+void sequence(void) {
+  OLED_init();
+  #if OLED_INIT_ON == 0
+  OLED_display(1);                                // init leaves the display off
+  #endif
+  OLED_clear();
+  OLED_contrast(0x80);
+  OLED_cursor(0, 0);
+  OLED_drawBitmap(BITMAP, 13, 2);
+  OLED_clearRect(3, 2);
+  KT_init();
+  KT_setChannel(KT_MHZ(98.8));
+  KT_setGain(3);
+  #if I2C_QUEUE > 0
+  I2C_flush();
+  #endif
+}
+
+#ifndef HOST_BUS
+int main(void) {
+  I2C_init();
+  sequence();
+  while(1);
+}
+#endif
@@ -0,0 +1,48 @@
+// ===================================================================================
+// Driver Size Comparison: Header-only C++ Drivers
+// ===================================================================================
+// Same sequence as drivers_c.c using the C++ drivers. Build both with
+// 'make compare', compare their I2C byte streams with 'make compare-host'.
+
+#include <system.h>
+#include <i2c_bus.hpp>
+#include <ssd1306.hpp>
+#include <kt0803.hpp>
+
+#ifdef HOST_BUS
+#include "host_bus.h"
+using Bus     = HostBus;                // records the byte stream on the host
+#else
+using Bus     = I2cBus<0, 400000>;
+#endif
+using Display = Oled<Bus, 128, 32>;
+using Radio   = Kt0803<Bus>;
+
+const uint8_t BITMAP[] = {
+  0xFC, 0xF9, 0xF3, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF3, 0xF9, 0xFC,
+  0x7F, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x7F
+};
+
+// Driver sequence (also called by host_bus.c)
+extern "C" void sequence(void) {
+  Display::init();
+  #if OLED_INIT_ON == 0
+  Display::display(1);                  // init leaves the display off
+  #endif
+  Display::clear();
+  Display::contrast(0x80);
+  Display::cursor(0, 0);
+  Display::drawBitmap(BITMAP, 13, 2);
+  Display::clearRect(3, 2);
+  Radio::init();
+  Radio::setChannel(Radio::MHz(98.8));
+  Radio::setGain(3);
+}
+
+#ifndef HOST_BUS
+int main(void) {
+  Bus::init();
+  sequence();
+  while(1);
+}
+#endif
@@ -0,0 +1,39 @@
+// ===================================================================================
+// Host I2C Bus for the Driver Comparison
+// ===================================================================================
+// Replaces the I2C and delay functions of the C drivers on the host and runs the
+// driver sequence of drivers_c.c or drivers_cpp.cpp (see host_bus.h).
+
+#include <stdio.h>
+#include "host_bus.h"
+#include "i2c_tx.h"
+#include "ssd1306_txt.h"
+
+void sequence(void);                    // drivers_c.c or drivers_cpp.cpp
+
+uint32_t HOST_bytes;                    // number of bytes recorded
+
+// Record transactions
+void HOST_start(uint8_t addr) { printf("%02X:", addr); HOST_bytes++; }
+void HOST_write(uint8_t data) { printf(" %02X", data); HOST_bytes++; }
+void HOST_stop(void)          { printf("\n"); }
+
+// I2C functions of the C drivers, the devices always answer
+void I2C_init(void) {}
+void I2C_start(uint8_t addr)  { HOST_start(addr); }
+void I2C_write(uint8_t data)  { HOST_write(data); }
+void I2C_stop(void)           { HOST_stop(); }
+uint8_t I2C_probe(uint8_t addr) { return addr == OLED_ADDR; }
+uint8_t I2C_read(uint8_t addr)  { return (addr == OLED_ADDR) ? 0x06 : 0xFF; }
+
+// Delays take no time on the host
+void DLY_ticks(uint32_t n) {}
+void DLY_usLoop(uint32_t n) {}
+void DLY_msLoop(uint32_t n) {}
+uint32_t MIL_read(void) { return 0; }
+
+int main(void) {
+  sequence();
+  fprintf(stderr, "%u bytes\n", (unsigned)HOST_bytes);
+  return 0;
+}
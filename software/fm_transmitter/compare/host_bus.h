@@ -0,0 +1,34 @@
+// ===================================================================================
+// Host I2C Bus for the Driver Comparison
+// ===================================================================================
+// Records every I2C transaction as one line "addr: bytes" on stdout instead of
+// driving I2C1. Used by 'make compare-host' to check that the C and the C++ drivers
+// send the same byte stream for the same sequence.
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void HOST_start(uint8_t addr);          // start transaction (addr with R/W bit)
+void HOST_write(uint8_t data);          // record data byte
+void HOST_stop(void);                   // end transaction
+
+#ifdef __cplusplus
+};
+
+// Bus for the C++ drivers (same interface as I2cBus in i2c_bus.hpp)
+struct HostBus {
+  static void init(void) {}
+  static void start(uint8_t addr) { HOST_start(addr); }
+  static void write(uint8_t data) { HOST_write(data); }
+  static void stop(void) { HOST_stop(); }
+  static void writeBuffer(const uint8_t* buf, uint16_t len) {
+    while(len--) write(*buf++);
+    stop();
+  }
+};
+#endif
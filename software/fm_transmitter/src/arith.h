@@ -0,0 +1,82 @@
+// ===================================================================================
+// Multiply- and Division-free Arithmetic Functions for CH32V003              * v1.0 *
+// ===================================================================================
+//
+// The CH32V003 (RV32EC) has no hardware multiply or divide instructions. Variable
+// operands of '*', '/' and '%' are therefore handled by the software routines of
+// libgcc (__mulsi3, __udivsi3, __umodsi3, ...), which are slow and cost flash.
+// Operations with constants only are folded by the compiler and cost nothing.
+//
+// Functions available:
+// --------------------
+// ARITH_mul10(n)           Return n * 10 (shift and add)
+// ARITH_divu10(n)          Return n / 10 (reciprocal by shifts, exact for 32 bits)
+// ARITH_divu5(n)           Return n / 5  (exact for n < 2^31)
+// ARITH_divu(n,d)          Return n / d  (shift and subtract, variable divisor)
+// ARITH_bcd(n)             Return 16-bit n as packed BCD, 5 digits (double dabble)
+//
+// Use 'make check' to verify that no libgcc multiply or divide routines remain in
+// the final ELF.
+//
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+// Return n * 10
+static inline uint32_t ARITH_mul10(uint32_t n) {
+  return (n << 3) + (n << 1);
+}
+
+// Return n / 10 (Hacker's Delight, divu10)
+static inline uint32_t ARITH_divu10(uint32_t n) {
+  uint32_t q, r;
+  q = (n >> 1) + (n >> 2);                      // q = n * 0.8 (approximately)
+  q += q >> 4;
+  q += q >> 8;
+  q += q >> 16;
+  q >>= 3;                                      // q = n / 10 (may be one too small)
+  r = n - ARITH_mul10(q);                       // remainder
+  return q + (r > 9);                           // correct estimate
+}
+
+// Return n / 5 (n < 2^31)
+static inline uint32_t ARITH_divu5(uint32_t n) {
+  return ARITH_divu10(n << 1);
+}
+
+// Return n / d (binary long division)
+static inline uint32_t ARITH_divu(uint32_t n, uint32_t d) {
+  uint32_t q = 0, r = 0;
+  for(uint8_t i=32; i; i--) {
+    r = (r << 1) | (n >> 31);                   // next bit of dividend
+    n <<= 1;
+    q <<= 1;
+    if(r >= d) {
+      r -= d;
+      q |= 1;
+    }
+  }
+  return q;
+}
+
+// Return n as packed BCD (5 digits), one decimal digit per nibble (double dabble)
+static inline uint32_t ARITH_bcd(uint16_t n) {
+  uint32_t bcd = 0, c;
+  for(uint8_t i=16; i; i--) {
+    c    = (bcd + 0x33333) & 0x88888;           // nibbles >= 5 ...
+    bcd += (c >> 2) | (c >> 3);                 // ... get 3 added
+    bcd  = (bcd << 1) | (n >> 15);              // shift in next bit
+    n  <<= 1;
+  }
+  return bcd;
+}
+
+#ifdef __cplusplus
+};
+#endif
@@ -0,0 +1,50 @@
+// ===================================================================================
+// FM Band and Channel Step Configuration                                     * v1.0 *
+// ===================================================================================
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#include "band.h"
+
+// Band limits as channel codes (in 50kHz steps)
+const uint16_t BAND_LIMITS[BAND_NUM][2] = {
+  { KT_MHZ( 87.5), KT_MHZ(108.0) },           // Europe
+  { KT_MHZ( 88.1), KT_MHZ(107.9) },           // USA
+  { KT_MHZ( 76.0), KT_MHZ( 90.0) },           // Japan
+  { KT_MHZ( 76.0), KT_MHZ(108.0) }            // wide (whole KT0803K/L range)
+};
+
+// Current band and channel step (step width is 50kHz << BAND_stepIdx)
+uint8_t BAND_idx     = BAND_EUROPE;
+uint8_t BAND_stepIdx = STEP_100KHZ;
+
+// Select band
+void BAND_set(uint8_t band) {
+  if(band < BAND_NUM) BAND_idx = band;
+}
+
+// Select channel step
+void BAND_setStep(uint8_t step) {
+  if(step < STEP_NUM) BAND_stepIdx = step;
+}
+
+// Return next channel in direction (1: up, 0: down). The channel grid starts at the
+// lower band limit, channels off the grid snap to the neighbouring grid channel.
+uint16_t BAND_step(uint16_t ch, uint8_t dir) {
+  uint16_t min  = BAND_LIMITS[BAND_idx][0];
+  uint16_t max  = BAND_LIMITS[BAND_idx][1];
+  uint16_t step = (uint16_t)1 << BAND_stepIdx;
+  uint16_t off;
+
+  if((ch < min) || (ch > max)) return min;    // outside band -> start of band
+  off = (ch - min) & (step - 1);              // distance to channel grid
+  ch -= off;                                  // snap down to grid
+  if(dir) {                                   // step up
+    ch += step;
+    if(ch > max) ch = min;                    // wrap around to start of band
+  }
+  else if(!off) {                             // step down (if not snapped already)
+    if(ch == min) ch = max - ((max - min) & (step - 1)); // wrap around to end of band
+    else          ch -= step;
+  }
+  return ch;
+}
@@ -0,0 +1,58 @@
+// ===================================================================================
+// FM Band and Channel Step Configuration                                     * v1.0 *
+// ===================================================================================
+//
+// Maps the UP/DOWN steps of the user interface to KT0803K/L channel codes (50kHz
+// resolution) within the selected band, including wraparound at the band limits.
+//
+// Functions available:
+// --------------------
+// BAND_set(b)              Select band (see BAND_* below)
+// BAND_setStep(s)          Select channel step (see STEP_* below)
+// BAND_step(ch,dir)        Return next channel in direction (dir) (1: up, 0: down)
+// BAND_fine(ch)            Check if channel needs 50kHz display resolution
+// BAND_min(b), BAND_max(b) Lower and upper channel limit of band (b)
+//
+// Bands:
+// ------
+// BAND_EUROPE              87.5 - 108.0 MHz
+// BAND_USA                 88.1 - 107.9 MHz
+// BAND_JAPAN               76.0 -  90.0 MHz
+// BAND_WIDE                76.0 - 108.0 MHz
+//
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "kt0803.h"
+
+// Bands
+enum { BAND_EUROPE, BAND_USA, BAND_JAPAN, BAND_WIDE, BAND_NUM };
+
+// Channel steps
+enum { STEP_50KHZ, STEP_100KHZ, STEP_200KHZ, STEP_NUM };
+
+// Band Functions
+void BAND_set(uint8_t band);          // Select band
+void BAND_setStep(uint8_t step);      // Select channel step
+uint16_t BAND_step(uint16_t ch, uint8_t dir); // Return next channel (1: up, 0: down)
+
+// Current band and step
+extern uint8_t BAND_idx, BAND_stepIdx;
+
+// Band limits as channel codes
+extern const uint16_t BAND_LIMITS[BAND_NUM][2];
+#define BAND_min(b)       (BAND_LIMITS[b][0])
+#define BAND_max(b)       (BAND_LIMITS[b][1])
+
+// Check if channel needs 50kHz display resolution
+#define BAND_fine(ch)     ((BAND_stepIdx == STEP_50KHZ) || ((ch) & 1))
+
+#ifdef __cplusplus
+};
+#endif
@@ -0,0 +1,63 @@
+// ===================================================================================
+// Hardware-scrolled Text Console on SSD1306 OLED Text Functions              * v1.0 *
+// ===================================================================================
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#include "console.h"
+
+extern const uint8_t OLED_FONT[];                 // 5x8 font (ssd1306_txt.c)
+
+// Console state
+char    CON_buf[CON_COLS];                        // line buffer
+uint8_t CON_len;                                  // characters in line buffer
+uint8_t CON_page;                                 // RAM page of the next line
+uint8_t CON_rows;                                 // lines on the screen
+
+// Clear screen and start console
+void CON_open(void) {
+  OLED_clear();                                   // clear visible pages
+  OLED_window(OLED_XOFF, OLED_XOFF + OLED_WIDTH - 1, 0, 7); // all pages, page 0 next
+  OLED_startline(0);
+  CON_len  = 0;
+  CON_page = 0;
+  CON_rows = 0;
+}
+
+// Send line buffer to the next page, scroll if the screen is full
+void CON_newline(void) {
+  uint8_t  i;
+  uint16_t ptr;
+  OLED_start();                                   // start transmission to OLED
+  OLED_ctrl(OLED_DAT_MODE);                       // set data mode
+  for(i=0; i<CON_len; i++) {
+    ptr  = CON_buf[i] - 32;                       // character pointer
+    ptr += ptr << 2;                              // -> ptr = (ch - 32) * 5
+    OLED_send(0x00);                              // space between characters
+    for(uint8_t j=5; j; j--) OLED_send(OLED_FONT[ptr++]);
+  }
+  i = OLED_WIDTH - (CON_len << 2) - (CON_len << 1); // -> i = WIDTH - 6 * len
+  while(i--) OLED_send(0x00);                     // clear rest of line
+  OLED_end();                                     // stop transmission
+  CON_len  = 0;
+  CON_page = (CON_page + 1) & 7;                  // data pointer is there already
+  if(CON_rows < CON_LINES) CON_rows++;            // screen not full yet
+  else OLED_startline(((CON_page - CON_LINES) & 7) << 3); // scroll one line
+}
+
+// Write character, '\n' sends the line and scrolls
+void CON_write(char c) {
+  c &= 0x7f;                                      // ignore top bit
+  if(c == '\n') CON_newline();
+  else if((c >= 32) && (CON_len < CON_COLS)) CON_buf[CON_len++] = c;
+}
+
+// Write string
+void CON_print(const char* str) {
+  while(*str) CON_write(*str++);
+}
+
+// Reset start line and RAM window, screen must be redrawn
+void CON_close(void) {
+  OLED_startline(0);
+  OLED_window(OLED_XOFF, OLED_XOFF + OLED_WIDTH - 1, 0, OLED_HEIGHT / 8 - 1); // full screen
+}
@@ -0,0 +1,51 @@
+// ===================================================================================
+// Hardware-scrolled Text Console on SSD1306 OLED Text Functions              * v1.0 *
+// ===================================================================================
+//
+// Rolling log for field debugging. The SSD1306 has RAM for 64 pixel lines (8 pages),
+// of which OLED_HEIGHT are shown starting at the display start line. The console
+// uses all 8 pages as a ring of text lines: each new line is written into the next
+// page below the visible area, then the start line is moved down by one page. Lines
+// already on the screen are never sent again.
+//
+// The RAM window is set to all columns and pages when the console is opened, so in
+// horizontal addressing mode the data pointer moves on to the next page by itself
+// and a line is just one data transaction (OLED_WIDTH bytes) plus the start line
+// command. Characters are collected in a line buffer until '\n' is written.
+//
+// Functions available:
+// --------------------
+// CON_open()               Clear screen and start console
+// CON_write(c)             Write character (c), '\n' sends the line and scrolls
+// CON_print(str)           Write string (*str)
+// CON_close()              Reset start line and RAM window, screen must be redrawn
+//
+// With print.h the output can be formatted, e.g. printF(CON_write, "%5u\n", n).
+// While the console is open nothing else may be drawn on the OLED and the start
+// line must not be changed (PIXEL_SHIFT in main.c). SSD1306 only, tear-free for
+// OLED_HEIGHT below 64.
+//
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "ssd1306_txt.h"
+
+// Console Parameters
+#define CON_COLS        (OLED_WIDTH / 6)    // characters per line
+#define CON_LINES       (OLED_HEIGHT / 8)   // lines on the screen
+
+// Console Functions
+void CON_open(void);                        // clear screen and start console
+void CON_write(char c);                     // write character, '\n': send line
+void CON_print(const char* str);            // write string
+void CON_close(void);                       // reset start line and RAM window
+
+#ifdef __cplusplus
+};
+#endif
@@ -97,6 +97,7 @@ extern "C" {
 #endif
 
 #include "system.h"
+#include "arith.h"
 
 // ===================================================================================
 // Enumerate PIN designators (use these designators to define pins)
@@ -400,7 +401,7 @@ static inline uint16_t ADC_read(void) {
 
 static inline uint16_t ADC_read_VDD(void) {
   ADC_input_VREF();                             // set VREF as ADC input
-  return((uint32_t)1200 * 1023 / ADC_read());   // return VDD im mV
+  return ARITH_divu((uint32_t)1200 * 1023, ADC_read()); // return VDD im mV
 }
 
 // ===================================================================================
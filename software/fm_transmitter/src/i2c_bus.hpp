@@ -0,0 +1,69 @@
+// ===================================================================================
+// Header-only C++ I2C Master (write only) for CH32V003                       * v1.0 *
+// ===================================================================================
+//
+// C++ counterpart of i2c_tx.h. Pin mapping and clock rate are template parameters,
+// so the register setup is folded into constants and the byte functions are
+// inlined into the drivers using the bus (see ssd1306.hpp, kt0803.hpp). The pin
+// setup (I2C_setPins()) and the clock planner (I2C_CKCFGR()) are taken from i2c_tx.h.
+//
+// Usage:
+// ------
+// using Bus = I2cBus<0, 400000>;  // pin map (see i2c_tx.h), clock rate (Hz)
+// Bus::init();                    // init I2C
+// Bus::start(addr);               // start transmission, addr must contain R/W bit
+// Bus::write(b);                  // transmit one data byte
+// Bus::stop();                    // stop transmission
+// Bus::writeBuffer(buf,len);      // send buffer (*buf) with length (len) and stop
+//
+// External pull-up resistors (4k7 - 10k) are mandatory!
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#pragma once
+
+#include <stdint.h>
+#include "system.h"
+#include "i2c_tx.h"
+
+template<uint8_t Map = 0, uint32_t Rate = 400000>
+struct I2cBus {
+  static_assert(Map <= 2, "I2C pin map must be 0, 1 or 2");
+  static constexpr uint16_t CKCFGR = I2C_CKCFGR(Rate);
+
+  // Init I2C
+  static void init(void) {
+    I2C_setPins(Map);                             // setup SDA and SCL pins
+    RCC->APB1PCENR |= RCC_I2C1EN;                 // enable I2C module clock
+    I2C1->CTLR2     = I2C_FREQ;                   // set input clock rate (MHz)
+    I2C1->CKCFGR    = CKCFGR;                     // set clock divider and mode
+    I2C1->CTLR1     = I2C_CTLR1_PE;               // enable I2C
+  }
+
+  // Start I2C transmission (addr must contain R/W bit)
+  static inline void start(uint8_t addr) {
+    while(I2C1->STAR2 & I2C_STAR2_BUSY);          // wait until bus ready
+    I2C1->CTLR1 |= I2C_CTLR1_START;               // set START condition
+    while(!(I2C1->STAR1 & I2C_STAR1_SB));         // wait for START generated
+    I2C1->DATAR = addr;                           // send slave address + R/W bit
+    while(!(I2C1->STAR1 & I2C_STAR1_ADDR));       // wait for address transmitted
+    (void)I2C1->STAR2;                            // clear flags
+  }
+
+  // Send data byte via I2C bus
+  static inline void write(uint8_t data) {
+    while(!(I2C1->STAR1 & I2C_STAR1_TXE));        // wait for last byte transmitted
+    I2C1->DATAR = data;                           // send data byte
+  }
+
+  // Stop I2C transmission
+  static inline void stop(void) {
+    while(!(I2C1->STAR1 & I2C_STAR1_BTF));        // wait for last byte transmitted
+    I2C1->CTLR1 |= I2C_CTLR1_STOP;                // set STOP condition
+  }
+
+  // Send data buffer via I2C bus and stop
+  static void writeBuffer(const uint8_t* buf, uint16_t len) {
+    while(len--) write(*buf++);                   // write buffer
+    stop();                                       // stop transmission
+  }
+};
@@ -0,0 +1,122 @@
+// ===================================================================================
+// Software I2C Master Functions (write only, bit-banging) for CH32V003      * v1.0 *
+// ===================================================================================
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#include "i2c_tx.h"
+
+#if I2C_SOFT > 0
+#include "gpio.h"
+
+// Delay loop iterations per half clock period (about 3 cycles per iteration)
+#define I2C_SOFT_HALF   (F_CPU / (2 * I2C_CLKRATE))
+#define I2C_SOFT_LOOPS  ((I2C_SOFT_HALF > I2C_SOFT_OVH) ? ((I2C_SOFT_HALF - I2C_SOFT_OVH) / 3) : 0)
+
+// Pin macros (open-drain: high releases the line)
+#define I2C_SDA_low()   PIN_low(I2C_SOFT_SDA)
+#define I2C_SDA_high()  PIN_high(I2C_SOFT_SDA)
+#define I2C_SCL_low()   PIN_low(I2C_SOFT_SCL)
+#define I2C_SCL_high()  PIN_high(I2C_SOFT_SCL)
+
+uint8_t I2C_nack;                                   // 1: NACK, skip rest
+
+// Wait half a clock period
+static inline void I2C_delay(void) {
+  #if I2C_SOFT_LOOPS > 0
+  uint32_t n = I2C_SOFT_LOOPS;
+  __asm__ volatile("1: addi %0, %0, -1 \n bnez %0, 1b" : "+r" (n));
+  #endif
+}
+
+// Shift out one byte (SCL is low), return 1 if acknowledged (or if not sampled)
+static inline uint8_t I2C_shift(uint8_t data, uint8_t sample) {
+  uint8_t i, ack = 1;
+  for(i=8; i; i--, data<<=1) {
+    (data & 0x80) ? I2C_SDA_high() : I2C_SDA_low(); // set data bit
+    I2C_delay();
+    I2C_SCL_high();                                 // clock high
+    I2C_delay();
+    I2C_SCL_low();                                  // clock low
+  }
+  I2C_SDA_high();                                   // release SDA for acknowledge
+  I2C_delay();
+  I2C_SCL_high();                                   // 9th clock pulse
+  I2C_delay();
+  if(sample) ack = !PIN_read(I2C_SOFT_SDA);         // slave pulls SDA low on ACK
+  I2C_SCL_low();
+  return ack;
+}
+
+// Init I2C
+void I2C_init(void) {
+  I2C_SDA_high();                                   // release both lines
+  I2C_SCL_high();
+  PIN_output_OD(I2C_SOFT_SDA);                      // set pins to open-drain output
+  PIN_output_OD(I2C_SOFT_SCL);
+}
+
+// Send START condition and address (addr must contain R/W bit)
+void I2C_address(uint8_t addr) {
+  I2C_SDA_low();                                    // START: SDA low while SCL high
+  I2C_delay();
+  I2C_SCL_low();
+  I2C_nack = !I2C_shift(addr, !I2C_FASTPUSH);       // send slave address + R/W bit
+}
+
+// Send data byte via I2C bus, skipped after a NACK
+RAMFUNC void I2C_write(uint8_t data) {
+  #if I2C_FASTPUSH > 0
+  I2C_shift(data, 0);                               // acknowledge is not sampled
+  #else
+  if(!I2C_nack) I2C_nack = !I2C_shift(data, 1);
+  #endif
+}
+
+// Stop I2C transmission
+void I2C_stop(void) {
+  I2C_SDA_low();
+  I2C_delay();
+  I2C_SCL_high();
+  I2C_delay();
+  I2C_SDA_high();                                   // STOP: SDA high while SCL high
+  I2C_delay();                                      // bus free time
+  I2C_nack = 0;
+}
+
+// Check if device responds: send address and a zero byte (register pointer or
+// command mode on most devices, no side effects), return 1 if both were acknowledged
+uint8_t I2C_probe(uint8_t addr) {
+  uint8_t ack;
+  I2C_SDA_low();                                    // START
+  I2C_delay();
+  I2C_SCL_low();
+  ack = I2C_shift(addr << 1, 1) && I2C_shift(0, 1); // address and zero byte
+  I2C_stop();
+  return ack;
+}
+
+// Read one byte from device without register pointer (e.g. status byte), the byte
+// is not acknowledged, 0xFF if there is no answer
+uint8_t I2C_read(uint8_t addr) {
+  uint8_t i, data = 0xff;
+  I2C_SDA_low();                                    // START
+  I2C_delay();
+  I2C_SCL_low();
+  if(I2C_shift((addr << 1) | 1, 1)) {               // address acknowledged?
+    for(i=8; i; i--) {                              // SDA is released
+      I2C_delay();
+      I2C_SCL_high();                               // clock high
+      I2C_delay();
+      data = (data << 1) | PIN_read(I2C_SOFT_SDA);  // sample data bit
+      I2C_SCL_low();                                // clock low
+    }
+    I2C_delay();                                    // no acknowledge (SDA high)
+    I2C_SCL_high();                                 // 9th clock pulse
+    I2C_delay();
+    I2C_SCL_low();
+  }
+  I2C_stop();
+  return data;
+}
+
+#endif  // I2C_SOFT > 0
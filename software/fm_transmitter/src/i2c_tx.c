@@ -5,47 +5,64 @@
 
 #include "i2c_tx.h"
 
+// ===================================================================================
+// Hardware I2C (I2C1)
+// ===================================================================================
+#if I2C_SOFT == 0
+
+// Reset I2C module, set clock configuration and enable I2C
+void I2C_setup(uint16_t ck) {
+  I2C1->CTLR1     = I2C_CTLR1_SWRST;              // reset I2C module
+  I2C1->CTLR1     = 0;
+  I2C1->CTLR2     = I2C_FREQ;                     // set input clock rate (MHz)
+  I2C1->CKCFGR    = ck;                           // set clock divider and mode
+  #if I2C_DMA > 0
+  I2C1->CTLR2    |= I2C_CTLR2_DMAEN;              // DMA requests (channel decides)
+  #endif
+  I2C1->CTLR1     = I2C_CTLR1_PE;                 // enable I2C
+}
+
+#if I2C_PROBE > 0
+// Device with probed clock rate and its clock configuration
+uint8_t  I2C_fastAddr;                            // 7-bit address, 0: none
+uint16_t I2C_fastCK;
+
+// Change clock configuration if necessary (bus must be idle)
+void I2C_clock(uint16_t ck) {
+  if(I2C1->CKCFGR == ck) return;                  // nothing to do
+  I2C1->CTLR1 &= ~I2C_CTLR1_PE;                   // disable I2C to change clock
+  I2C1->CKCFGR = ck;                              // set new clock
+  I2C1->CTLR1 |= I2C_CTLR1_PE;                    // enable I2C
+}
+#endif
+
 // Init I2C
 void I2C_init(void) {
   // Setup GPIO pins
-  #if I2C_MAP == 0
-    // Set pin PC1 (SDA) and PC2 (SCL) to output, open-drain, 10MHz, multiplex
-    RCC->APB2PCENR |= RCC_AFIOEN | RCC_IOPCEN;
-    GPIOC->CFGLR = (GPIOC->CFGLR & ~(((uint32_t)0b1111<<(1<<2)) | ((uint32_t)0b1111<<(2<<2))))
-                                 |  (((uint32_t)0b1101<<(1<<2)) | ((uint32_t)0b1101<<(2<<2)));
-  #elif I2C_MAP == 1
-    // Set pin PD0 (SDA) and PD1 (SCL) to output, open-drain, 10MHz, multiplex
-    RCC->APB2PCENR |= RCC_AFIOEN | RCC_IOPDEN;
-    AFIO->PCFR1    |= 1<<1;
-    GPIOD->CFGLR = (GPIOD->CFGLR & ~(((uint32_t)0b1111<<(0<<2)) | ((uint32_t)0b1111<<(1<<2))))
-                                 |  (((uint32_t)0b1101<<(0<<2)) | ((uint32_t)0b1101<<(1<<2)));
-  #elif I2C_MAP == 2
-    // Set pin PC6 (SDA) and PC5 (SCL) to output, open-drain, 10MHz, multiplex
-    RCC->APB2PCENR |= RCC_AFIOEN | RCC_IOPCEN;
-    AFIO->PCFR1    |= 1<<22;
-    GPIOC->CFGLR = (GPIOC->CFGLR & ~(((uint32_t)0b1111<<(6<<2)) | ((uint32_t)0b1111<<(5<<2))))
-                                 |  (((uint32_t)0b1101<<(6<<2)) | ((uint32_t)0b1101<<(5<<2)));
-  #else
-    #warning Wrong I2C REMAP
+  I2C_setPins(I2C_MAP);
+
+  // Setup TX DMA (I2C1_TX is hard-wired to DMA1 channel 6)
+  #if I2C_DMA > 0
+  RCC->AHBPCENR |= RCC_DMA1EN;                    // enable DMA module clock
+  DMA1_Channel6->PADDR = (uint32_t)&I2C1->DATAR;  // peripheral address
   #endif
 
   // Setup and enable I2C
   RCC->APB1PCENR |= RCC_I2C1EN;                   // enable I2C module clock
-  I2C1->CTLR2     = 4;                            // set input clock rate
-  #if I2C_CLKRATE > 100000                        // Fast mode ?
-    I2C1->CKCFGR  = (F_CPU / (3 * I2C_CLKRATE))   // -> set clock division factor 1:2
-                  | I2C_CKCFGR_FS;                // -> enable fast mode (400kHz)
-  #else                                           // Standard mode?
-    I2C1->CKCFGR  = (F_CPU / (2 * I2C_CLKRATE));  // -> set clock division factor 1:1
-  #endif
-  I2C1->CTLR1   = I2C_CTLR1_PE;                   // enable I2C
+  I2C_setup(I2C_CKCFGR(I2C_CLKRATE));             // set clock rate and enable I2C
 }
 
-// Start I2C transmission (addr must contain R/W bit)
+// Send START condition and address (addr must contain R/W bit)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-variable"
-void I2C_start(uint8_t addr) {
+void I2C_address(uint8_t addr) {
+  #if I2C_DMA > 0
+  I2C_waitDMA();                                  // finish DMA transmission first
+  #endif
   while(I2C1->STAR2 & I2C_STAR2_BUSY);            // wait until bus ready
+  #if I2C_PROBE > 0
+  I2C_clock(((addr >> 1) == I2C_fastAddr) ? I2C_fastCK : I2C_CKCFGR(I2C_CLKRATE));
+  #endif
   I2C1->CTLR1 |= I2C_CTLR1_START;                 // set START condition
   while(!(I2C1->STAR1 & I2C_STAR1_SB));           // wait for START generated
   I2C1->DATAR = addr;                             // send slave address + R/W bit
@@ -55,7 +72,7 @@ void I2C_start(uint8_t addr) {
 #pragma GCC diagnostic pop
 
 // Send data byte via I2C bus
-void I2C_write(uint8_t data) {
+RAMFUNC void I2C_write(uint8_t data) {
   while(!(I2C1->STAR1 & I2C_STAR1_TXE));          // wait for last byte transmitted
   I2C1->DATAR = data;                             // send data byte
 }
@@ -66,8 +83,233 @@ void I2C_stop(void) {
   I2C1->CTLR1 |= I2C_CTLR1_STOP;                  // set STOP condition
 }
 
+#if I2C_DMA > 0
+// Wait for DMA transfer to finish
+void I2C_waitDMA(void) {
+  if(DMA1_Channel6->CFGR & DMA_CFGR1_EN) {        // transfer running?
+    while(!(DMA1->INTFR & DMA_TCIF6));            // wait for transfer complete
+    DMA1->INTFCR = DMA_CGIF6;                     // clear flags
+    DMA1_Channel6->CFGR = 0;                      // disable channel
+  }
+}
+
+// Send buffer via DMA within the started transmission, returns at once
+void I2C_writeDMA(const uint8_t* buf, uint16_t len) {
+  I2C_waitDMA();                                  // previous buffer sent?
+  DMA1_Channel6->MADDR = (uint32_t)buf;           // memory address
+  DMA1_Channel6->CNTR  = len;                     // number of bytes
+  DMA1_Channel6->CFGR  = DMA_CFGR1_MINC           // increment memory address
+                       | DMA_CFGR1_DIR            // memory to peripheral
+                       | DMA_CFGR1_EN;            // enable channel
+}
+
+// Wait for DMA transfer to finish, then send STOP condition
+void I2C_stopDMA(void) {
+  I2C_waitDMA();                                  // last buffer sent?
+  I2C_stop();                                     // last byte, then STOP
+}
+#endif  // I2C_DMA > 0
+
+// Wait for status flag(s) with timeout, return 0 on timeout or acknowledge failure
+uint8_t I2C_wait(uint16_t flags) {
+  uint16_t timeout = I2C_TIMEOUT;
+  while(!(I2C1->STAR1 & flags)) {
+    if((I2C1->STAR1 & I2C_STAR1_AF) || !(--timeout)) return 0;
+  }
+  return 1;
+}
+
+// Check if device responds: send address and a zero byte (register pointer or
+// command mode on most devices, no side effects), return 1 if both were acknowledged
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+uint8_t I2C_probe(uint8_t addr) {
+  uint8_t ack = 0;
+  uint16_t timeout = I2C_TIMEOUT;
+  #if I2C_DMA > 0
+  I2C_waitDMA();                                  // finish DMA transmission first
+  #endif
+  while(I2C1->STAR2 & I2C_STAR2_BUSY) {           // wait until bus ready
+    if(!(--timeout)) goto reset;
+  }
+  I2C1->CTLR1 |= I2C_CTLR1_START;                 // set START condition
+  if(!I2C_wait(I2C_STAR1_SB)) goto reset;         // wait for START generated
+  I2C1->DATAR = addr << 1;                        // send slave address + write bit
+  if(I2C_wait(I2C_STAR1_ADDR)) {                  // address acknowledged?
+    uint16_t reg = I2C1->STAR2;                   // clear flags
+    I2C1->DATAR = 0;                              // send zero byte
+    ack = I2C_wait(I2C_STAR1_BTF);                // data byte acknowledged?
+  }
+  I2C1->STAR1 &= ~I2C_STAR1_AF;                   // clear acknowledge failure
+  I2C1->CTLR1 |= I2C_CTLR1_STOP;                  // set STOP condition
+  timeout = I2C_TIMEOUT;
+  while(I2C1->CTLR1 & I2C_CTLR1_STOP) {           // wait for STOP generated
+    if(!(--timeout)) goto reset;
+  }
+  return ack;
+
+  reset:                                          // bus or module stuck
+  I2C_setup(I2C1->CKCFGR);
+  return 0;
+}
+#pragma GCC diagnostic pop
+
+// Read one byte from device without register pointer (e.g. status byte), the byte
+// is not acknowledged (ACK bit is never set), 0xFF if there is no answer
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+uint8_t I2C_read(uint8_t addr) {
+  uint8_t data = 0xff;
+  uint16_t timeout = I2C_TIMEOUT;
+  #if I2C_DMA > 0
+  I2C_waitDMA();                                  // finish DMA transmission first
+  #endif
+  while(I2C1->STAR2 & I2C_STAR2_BUSY) {           // wait until bus ready
+    if(!(--timeout)) goto reset;
+  }
+  I2C1->CTLR1 |= I2C_CTLR1_START;                 // set START condition
+  if(!I2C_wait(I2C_STAR1_SB)) goto reset;         // wait for START generated
+  I2C1->DATAR = (addr << 1) | 1;                  // send slave address + read bit
+  if(I2C_wait(I2C_STAR1_ADDR)) {                  // address acknowledged?
+    uint16_t reg = I2C1->STAR2;                   // clear flags, start receiving
+    I2C1->CTLR1 |= I2C_CTLR1_STOP;                // STOP after this byte
+    if(I2C_wait(I2C_STAR1_RXNE)) data = I2C1->DATAR;
+  }
+  else {
+    I2C1->STAR1 &= ~I2C_STAR1_AF;                 // clear acknowledge failure
+    I2C1->CTLR1 |= I2C_CTLR1_STOP;                // set STOP condition
+  }
+  timeout = I2C_TIMEOUT;
+  while(I2C1->CTLR1 & I2C_CTLR1_STOP) {           // wait for STOP generated
+    if(!(--timeout)) goto reset;
+  }
+  return data;
+
+  reset:                                          // bus or module stuck
+  I2C_setup(I2C1->CKCFGR);
+  return 0xff;
+}
+#pragma GCC diagnostic pop
+
+#if I2C_PROBE > 0
+// Find fastest reliable clock rate for device: step clock divider down (fast mode,
+// duty cycle 2:1) until I2C_PROBE_MAX is reached or a transfer fails, then fall back
+// to the last good setting. This clock rate is only used for this device.
+void I2C_probeClock(uint8_t addr) {
+  uint16_t ck   = I2C_CK_FM(I2C_CLKRATE);         // start at nominal clock rate
+  uint16_t good = I2C_CKCFGR(I2C_CLKRATE);        // last good setting
+  uint8_t  i;
+
+  I2C_fastAddr = 0;                               // use I2C_clock() directly
+  while(ck >= I2C_CK_FM(I2C_PROBE_MAX)) {
+    I2C_clock(ck);
+    for(i=I2C_PROBE_TRY; i; i--) if(!I2C_probe(addr)) break;
+    if(i) break;                                  // failed -> fall back
+    good = ck;
+    if((ck & I2C_CKCFGR_CCR) <= 1) break;         // fastest divider reached
+    ck--;
+  }
+  I2C_clock(I2C_CKCFGR(I2C_CLKRATE));             // back to nominal clock rate
+  I2C_fastCK   = good;
+  I2C_fastAddr = addr;
+}
+#endif  // I2C_PROBE > 0
+
+#endif  // I2C_SOFT == 0
+
+// ===================================================================================
+// Common Functions (hardware and software I2C)
+// ===================================================================================
+
+// Start I2C transmission (addr must contain R/W bit)
+void I2C_start(uint8_t addr) {
+  #if I2C_QUEUE > 0
+  I2C_idle();                                     // run time-critical tasks
+  I2C_flush();                                    // queued transactions go first
+  #endif
+  I2C_address(addr);                              // start this transaction
+}
+
 // Send data buffer via I2C bus and stop
 void I2C_writeBuffer(uint8_t* buf, uint16_t len) {
   while(len--) I2C_write(*buf++);           // write buffer
   I2C_stop();                               // stop transmission
 }
+
+// ===================================================================================
+// I2C Transaction Queue
+// ===================================================================================
+#if I2C_QUEUE > 0
+
+// Queued register write transaction
+typedef struct {
+  uint8_t addr;                             // device address (7-bit), 0: slot empty
+  uint8_t prio;                             // priority
+  uint8_t reg;                              // start register
+  uint8_t len;                              // number of data bytes
+  uint8_t data[I2C_QUEUE_BUF];              // data bytes
+} I2C_TRANSACTION;
+
+I2C_TRANSACTION I2C_queue[I2C_QUEUE_LEN];   // transaction queue (in order of posting)
+
+// Default hook before each directly started transaction (does nothing)
+__attribute__((weak)) void I2C_idle(void) {}
+
+// Queue register write, merge with queued write to the same device if possible
+void I2C_post(uint8_t addr, uint8_t reg, const uint8_t* buf, uint8_t len, uint8_t prio) {
+  I2C_TRANSACTION* t = I2C_queue;
+  uint8_t i, first, last;
+
+  // Split writes that do not fit into one slot
+  while(len > I2C_QUEUE_BUF) {
+    I2C_post(addr, reg, buf, I2C_QUEUE_BUF, prio);
+    reg += I2C_QUEUE_BUF;
+    buf += I2C_QUEUE_BUF;
+    len -= I2C_QUEUE_BUF;
+  }
+
+  // Try to merge with a queued write to adjacent or overlapping registers
+  for(i=I2C_QUEUE_LEN; i; i--, t++) {
+    if(t->addr != addr) continue;
+    first = (reg < t->reg) ? reg : t->reg;
+    last  = ((reg + len) > (t->reg + t->len)) ? (reg + len) : (t->reg + t->len);
+    if((reg > t->reg + t->len) || (t->reg > reg + len) || (last - first > I2C_QUEUE_BUF)) continue;
+    if(first < t->reg) {                    // extend range downwards
+      uint8_t shift = t->reg - first;
+      uint8_t j = t->len;
+      while(j--) t->data[j + shift] = t->data[j];
+    }
+    t->reg = first;
+    t->len = last - first;
+    if(prio > t->prio) t->prio = prio;
+    for(i=0; i<len; i++) t->data[reg - first + i] = buf[i]; // latest data wins
+    return;
+  }
+
+  // Otherwise append to the queue (send queue first if it is full)
+  if(I2C_queue[I2C_QUEUE_LEN - 1].addr) I2C_flush();
+  for(t=I2C_queue; t->addr; t++);
+  t->addr = addr;
+  t->prio = prio;
+  t->reg  = reg;
+  t->len  = len;
+  for(i=0; i<len; i++) t->data[i] = buf[i];
+}
+
+// Send all queued transactions, highest priority first, in order of posting otherwise
+void I2C_flush(void) {
+  while(I2C_queue[0].addr) {
+    I2C_TRANSACTION* t = I2C_queue;
+    uint8_t i, next = 0;
+    for(i=1; (i<I2C_QUEUE_LEN) && I2C_queue[i].addr; i++) {
+      if(I2C_queue[i].prio > I2C_queue[next].prio) next = i;
+    }
+    t += next;
+    I2C_address(t->addr << 1);              // send transaction
+    I2C_write(t->reg);
+    I2C_writeBuffer(t->data, t->len);
+    for(; next < I2C_QUEUE_LEN - 1; next++) I2C_queue[next] = I2C_queue[next + 1];
+    I2C_queue[I2C_QUEUE_LEN - 1].addr = 0;  // remove from queue
+  }
+}
+#endif  // I2C_QUEUE > 0
@@ -2,6 +2,9 @@
 // Basic I2C Master Functions (write only) for CH32V003                       * v1.3 *
 // ===================================================================================
 //
+// Uses the hardware I2C1 module on the pins selected by I2C_MAP or, if I2C_SOFT is
+// set, a bit-banged software I2C on any two GPIO pins (I2C_SOFT_SDA, I2C_SOFT_SCL).
+//
 // Functions available:
 // --------------------
 // I2C_init()               Init I2C with defined clock rate (400kHz)
@@ -9,6 +12,45 @@
 // I2C_write(b)             I2C transmit one data byte via I2C
 // I2C_stop()               I2C stop transmission
 // I2C_writeBuffer(buf,len) Send buffer (*buf) with length (len) via I2C and stop
+// I2C_probe(a)             Check if device with address (a, 7-bit) responds (1: yes)
+// I2C_read(a)              Read one byte from device (a, 7-bit) without register
+//                          pointer (e.g. status byte), 0xFF if there is no answer
+// I2C_probeClock(a)        Find fastest reliable clock rate for device (a, 7-bit) by
+//                          stepping up from I2C_CLKRATE to I2C_PROBE_MAX, the rate is
+//                          used for this device only (if I2C_PROBE > 0)
+//
+// DMA functions (if I2C_DMA > 0, hardware I2C only):
+// ---------------------------------------------------
+// I2C_writeDMA(buf,len)    Send buffer (*buf) with length (len) via DMA within the
+//                          started transmission, returns at once (buffer must stay
+//                          valid until the next I2C_writeDMA() or I2C_stopDMA())
+// I2C_stopDMA()            Wait for the DMA transfer, then send STOP condition
+// I2C_waitDMA()            Wait for DMA transfer to finish
+//
+// I2C1_TX is hard-wired to DMA1 channel 6. Several buffers can be sent one after
+// another in one transmission, each I2C_writeDMA() waits for the previous one, so
+// the next buffer can be filled while the last one is being sent. A transmission
+// must be ended with I2C_stopDMA(), which waits only for the last buffer, so the
+// bus is released before it returns.
+//
+// Transaction queue functions (if I2C_QUEUE > 0):
+// -----------------------------------------------
+// I2C_post(a,r,buf,len,p)  Queue register write: device address (a, 7-bit), start
+//                          register (r), data buffer (*buf, len bytes), priority (p)
+// I2C_flush()              Send all queued transactions (highest priority first)
+// I2C_idle()               Hook called before each directly started transaction
+//                          (weak, override it to run time-critical tasks)
+//
+// The queue lets short register writes (e.g. KT0803 changes) overtake long streamed
+// transfers (e.g. OLED redraws): queued transactions are sent at every transaction
+// boundary, i.e. before each I2C_start(). Writes to the same device with adjacent or
+// overlapping register ranges are merged into a single transaction, the latest data
+// wins. Writes longer than I2C_QUEUE_BUF are split into several transactions. Call
+// I2C_flush() if the order of two writes to the same device matters.
+//
+// Only register writes are queued (KT0803). OLED transfers are streamed directly
+// with I2C_start() and are the transaction boundaries at which the queue is sent;
+// queuing them would copy every display byte into a slot and delay the redraw.
 //
 // I2C pin mapping (set below in I2C parameters):
 // ----------------------------------------------
@@ -16,6 +58,57 @@
 // SDA-pin   PC1   PD0   PC6
 // SCL-pin   PC2   PD1   PC5
 //
+// I2C clock planner:
+// ------------------
+// I2C_CKCFGR(rate) returns the clock register setting (divider, fast mode and duty
+// cycle) for the fastest clock not above (rate) at the selected F_CPU. It is folded
+// into a constant at compile time. Achieved clock rates and the resulting time for a
+// full 128x32 OLED frame (512 bytes, about 80% bus utilization) at the nominal rate
+// and at the fastest rate tried by I2C_probeClock():
+//
+// F_CPU   |  400kHz requested  |  fastest step (divider or I2C_PROBE_MAX)
+// --------+--------------------+-----------------------------------------
+// 48MHz   |  400kHz, 14.4ms    |  1000kHz,  5.8ms
+// 24MHz   |  400kHz, 14.4ms    |  1000kHz,  5.8ms
+// 16MHz   |  381kHz, 15.1ms    |   889kHz,  6.5ms
+// 12MHz   |  400kHz, 14.4ms    |  1000kHz,  5.8ms
+//  8MHz   |  381kHz, 15.1ms    |   889kHz,  6.5ms
+//  6MHz   |  400kHz, 14.4ms    |  1000kHz,  5.8ms
+//  4MHz   |  333kHz, 17.3ms    |   667kHz,  8.6ms
+//
+// Rates above 400kHz are outside the I2C specification, whether they work depends
+// on the device, the pull-up resistors and the bus capacitance. The KT0803 is
+// always addressed at I2C_CLKRATE.
+//
+// Software I2C:
+// -------------
+// The bit timing is derived from F_CPU and I2C_CLKRATE at compile time with an
+// estimated loop overhead (I2C_SOFT_OVH cycles per half clock period), at low F_CPU
+// the loop overhead limits the clock rate. Clock stretching is not supported (not
+// used by the OLED and the KT0803). The acknowledge bit of the address and of every
+// data byte is sampled; after a NACK the remaining data bytes of the transaction are
+// not clocked out, so a missing device does not cost a whole OLED frame of bus
+// time. I2C_FASTPUSH skips sampling and checking (the 9th clock pulse is still sent)
+// and pushes every byte blindly, I2C_probe() and I2C_read() always sample it.
+// I2C_PROBE is not available with software I2C.
+//
+// CPU time per data byte (estimated, 9 clock pulses plus call overhead), the bus
+// time of hardware I2C at 400kHz (381kHz at 8MHz) is 22.5us (23.6us):
+//
+// F_CPU   |  I2C1 polled  |  I2C1 DMA  |  software I2C  |  I2C_FASTPUSH
+// --------+---------------+------------+----------------+--------------
+// 48MHz   |  1080 cycles  |  ~0        |  1110 cycles   |  1100 cycles
+// 24MHz   |   540 cycles  |  ~0        |   570 cycles   |   560 cycles
+//  8MHz   |   189 cycles  |  ~0        |   170 cycles   |   164 cycles
+//
+// Polled hardware I2C waits for the bus, so its CPU time equals the bus time. With
+// DMA the CPU only waits for the last buffer of a transmission (I2C_stopDMA()). The
+// software loop is timed to I2C_CLKRATE as long as half a clock period is longer
+// than I2C_SOFT_OVH; at 8MHz it is limited by the loop overhead (about 16 cycles per
+// bit, i.e. about 20us per byte). Sampling the acknowledge bit costs about 6 cycles
+// per byte, negligible against the bus time, so I2C_FASTPUSH mainly makes sense
+// for write-only wiring where SDA cannot be read back.
+//
 // External pull-up resistors (4k7 - 10k) are mandatory!
 // 2023 by Stefan Wagner:   https://github.com/wagiminator
 
@@ -29,14 +122,106 @@ extern "C" {
 
 // I2C Parameters
 #define I2C_CLKRATE   400000    // I2C bus clock rate (Hz)
+#define I2C_PROBE     0         // 1: enable per-device clock probing
+#define I2C_PROBE_MAX 1000000   // maximum clock rate tried by I2C_probeClock() (Hz)
+#define I2C_PROBE_TRY 16        // number of successful transfers to accept a rate
+#define I2C_TIMEOUT   10000     // timeout of I2C_probe() in polling loops
 #define I2C_MAP       0         // I2C pin mapping (see above)
+#define I2C_SOFT      0         // 1: use software I2C (bit-banging) instead of I2C1
+#define I2C_SOFT_SDA  PC1       // software I2C SDA pin
+#define I2C_SOFT_SCL  PC2       // software I2C SCL pin
+#define I2C_SOFT_OVH  8         // estimated loop overhead per half clock (cycles)
+#define I2C_FASTPUSH  0         // 1: software I2C ignores acknowledge bits
+#define I2C_DMA       0         // 1: enable DMA transfers (I2C_writeDMA())
+#ifndef I2C_QUEUE
+  #define I2C_QUEUE   1         // 1: enable prioritized transaction queue
+#endif
+#define I2C_QUEUE_LEN 4         // number of transactions in queue
+#define I2C_QUEUE_BUF 12        // max data bytes per queued transaction (16-byte slots)
+
+#if I2C_SOFT > 0 && I2C_PROBE > 0
+  #warning I2C_PROBE is not supported by software I2C
+  #undef  I2C_PROBE
+  #define I2C_PROBE 0
+#endif
+
+#if I2C_SOFT > 0 && I2C_DMA > 0
+  #warning I2C_DMA is not supported by software I2C
+  #undef  I2C_DMA
+  #define I2C_DMA 0
+#endif
+
+// I2C clock planner (see above)
+#define I2C_DIV(n,r)        ((F_CPU + (n) * (r) - 1) / ((n) * (r)))
+#define I2C_CK_SM(r)        ((I2C_DIV(2,r) < 4) ? 4 : I2C_DIV(2,r))
+#define I2C_CK_FM(r)        (I2C_DIV(3,r)  | I2C_CKCFGR_FS)
+#define I2C_CK_FM169(r)     (I2C_DIV(25,r) | I2C_CKCFGR_FS | I2C_CKCFGR_DUTY)
+#define I2C_CKCFGR(r)       (((r) <= 100000) ? I2C_CK_SM(r) :                         \
+                            ((25 * I2C_DIV(25,r) < 3 * I2C_DIV(3,r)) ? I2C_CK_FM169(r) \
+                                                                    : I2C_CK_FM(r)))
+#define I2C_FREQ            ((F_CPU < 2000000) ? 2 : (F_CPU / 1000000))
+
+#if I2C_MAP > 2
+  #warning Wrong I2C REMAP
+#endif
+
+// Set SDA and SCL pins of pin mapping (map) to output, open-drain, 10MHz, multiplex
+// (also used by i2c_bus.hpp, folded into constant stores for constant map)
+static inline void I2C_setPins(uint8_t map) {
+  if(map == 0) {
+    // Set pin PC1 (SDA) and PC2 (SCL)
+    RCC->APB2PCENR |= RCC_AFIOEN | RCC_IOPCEN;
+    GPIOC->CFGLR = (GPIOC->CFGLR & ~(((uint32_t)0b1111<<(1<<2)) | ((uint32_t)0b1111<<(2<<2))))
+                                 |  (((uint32_t)0b1101<<(1<<2)) | ((uint32_t)0b1101<<(2<<2)));
+  }
+  else if(map == 1) {
+    // Set pin PD0 (SDA) and PD1 (SCL)
+    RCC->APB2PCENR |= RCC_AFIOEN | RCC_IOPDEN;
+    AFIO->PCFR1    |= 1<<1;
+    GPIOD->CFGLR = (GPIOD->CFGLR & ~(((uint32_t)0b1111<<(0<<2)) | ((uint32_t)0b1111<<(1<<2))))
+                                 |  (((uint32_t)0b1101<<(0<<2)) | ((uint32_t)0b1101<<(1<<2)));
+  }
+  else {
+    // Set pin PC6 (SDA) and PC5 (SCL)
+    RCC->APB2PCENR |= RCC_AFIOEN | RCC_IOPCEN;
+    AFIO->PCFR1    |= 1<<22;
+    GPIOC->CFGLR = (GPIOC->CFGLR & ~(((uint32_t)0b1111<<(6<<2)) | ((uint32_t)0b1111<<(5<<2))))
+                                 |  (((uint32_t)0b1101<<(6<<2)) | ((uint32_t)0b1101<<(5<<2)));
+  }
+}
+
+// I2C queue priorities
+#define I2C_PRIO_LOW  0
+#define I2C_PRIO_HIGH 1
 
 // I2C Functions
 void I2C_init(void);            // I2C init function
 void I2C_start(uint8_t addr);   // I2C start transmission, addr must contain R/W bit
+void I2C_address(uint8_t addr); // I2C start transmission without sending the queue
 void I2C_write(uint8_t data);   // I2C transmit one data byte via I2C
 void I2C_stop(void);            // I2C stop transmission
 void I2C_writeBuffer(uint8_t* buf, uint16_t len);
+uint8_t I2C_probe(uint8_t addr);  // check if device responds (1: yes, 0: no)
+uint8_t I2C_read(uint8_t addr);   // read one byte from device (0xFF: no answer)
+
+// I2C Clock Probing
+#if I2C_PROBE > 0
+void I2C_probeClock(uint8_t addr);  // find fastest reliable clock rate for device
+#endif
+
+// I2C DMA Functions
+#if I2C_DMA > 0
+void I2C_writeDMA(const uint8_t* buf, uint16_t len); // send buffer via DMA, no wait
+void I2C_stopDMA(void);         // wait for DMA transfer, then STOP
+void I2C_waitDMA(void);         // wait for DMA transfer
+#endif
+
+// I2C Queue Functions
+#if I2C_QUEUE > 0
+void I2C_post(uint8_t addr, uint8_t reg, const uint8_t* buf, uint8_t len, uint8_t prio);
+void I2C_flush(void);           // send all queued transactions
+void I2C_idle(void);            // hook before each directly started transaction
+#endif
 
 #ifdef __cplusplus
 };
@@ -8,13 +8,25 @@
 // KT0803 registers 0x00 - 0x02
 uint8_t KT_regs[] = { 0x81, 0xC3, 0x41 };
 
-// Update KT0803 registers 0x00 - 0x02
+// Update KT0803 registers 0x00 - 0x02 (queued with high priority if I2C_QUEUE > 0)
 void KT_update(void) {
+  #if I2C_QUEUE > 0
+  I2C_post(KT_I2C_ADDR, 0, KT_regs, 3, I2C_PRIO_HIGH);
+  #else
   uint8_t i;
   I2C_start((KT_I2C_ADDR << 1) | 0);
   I2C_write(0);
   for(i=0; i<3; i++) I2C_write(KT_regs[i]);
   I2C_stop();
+  #endif
+}
+
+// Write register cache to KT0803 immediately (bypass queue)
+void KT_send(void) {
+  KT_update();
+  #if I2C_QUEUE > 0
+  I2C_flush();
+  #endif
 }
 
 // Setup KT0803
@@ -25,33 +37,117 @@ void KT_init(void) {
   KT_update();
 }
 
+// Load channel into register cache (in 50kHz steps, 1977 means 98.85MHz)
+// CHSEL[11:0] is split into reg 0x01[2:0] = CHSEL[11:9], reg 0x00 = CHSEL[8:1] and
+// reg 0x02[7] = CHSEL[0]
+void KT_loadChannel(uint16_t ch) {
+  KT_regs[0] = (uint8_t)(ch >> 1);
+  KT_regs[1] = (KT_regs[1] & 0xf8) | ((ch >> 9) & 0x07);
+  KT_regs[2] = (KT_regs[2] & 0x7f) | ((ch & 1) << 7);
+}
+
+// Set channel (in 50kHz steps, 1977 means 98.85MHz)
+void KT_setChannel(uint16_t ch) {
+  KT_loadChannel(ch);
+  KT_update();
+}
+
+// Get current channel (in 50kHz steps, 1977 means 98.85MHz)
+uint16_t KT_getChannel(void) {
+  return( (((uint16_t)KT_regs[1] & 0x0007) << 9) | ((uint16_t)KT_regs[0] << 1) | (KT_regs[2] >> 7) );
+}
+
+// Load frequency into register cache (in 100kHz steps, 885 means 88.5Mhz)
+void KT_loadFreq(uint16_t freq) {
+  KT_loadChannel(freq << 1);
+}
+
 // Set frequency (in 100kHz steps, 885 means 88.5Mhz)
 void KT_setFreq(uint16_t freq) {
-  KT_regs[0] = (uint8_t)freq;
-  KT_regs[1] = (KT_regs[1] & 0xf8) | ((freq >> 8) & 0x07);
+  KT_loadFreq(freq);
   KT_update();
 }
 
+// ===================================================================================
+// Click-free Retune Pipeline
+// ===================================================================================
+// KT_retune() only records the requested frequency, KT_poll() does the work:
+// 1. mute (if not muted by the user) and write the new channel (50kHz steps)
+// 2. wait KT_PLL_TIME without blocking
+// 3. if the target has changed meanwhile, write the latest target and go to 2.
+//    (requests within one settling period are coalesced, only the last one is sent)
+// 4. restore the user's mute state
+uint16_t KT_target;                           // requested channel
+uint8_t  KT_busy;                             // 1: waiting for PLL to settle
+uint8_t  KT_mute;                             // mute state requested by user
+uint32_t KT_time;                             // end of current settling period (ms)
+
+// Request channel change (in 50kHz steps), executed by KT_poll()
+void KT_retune(uint16_t ch) {
+  KT_target = ch;
+  KT_poll();
+}
+
+// Process pending frequency change, must be called regularly
+void KT_poll(void) {
+  if(KT_busy) {
+    if((int32_t)(MIL_read() - KT_time) < 0) return; // PLL still settling
+    if(KT_target == KT_getChannel()) {           // final frequency reached?
+      KT_busy = 0;
+      KT_loadMute(KT_mute);                   // restore mute state
+      KT_send();
+      return;
+    }
+  }
+  else {
+    if(!KT_target || (KT_target == KT_getChannel())) return; // nothing to do
+    KT_busy = 1;
+    if(!KT_mute) {
+      KT_regs[2] |= 0x08;                     // mute first
+      KT_send();
+    }
+  }
+  KT_loadChannel(KT_target);                  // write latest target channel
+  KT_send();
+  KT_time = MIL_read() + KT_PLL_TIME;         // start settling period
+}
+
 // Get current frequency (in 100kHz steps, 885 means 88.5Mhz)
 uint16_t KT_getFreq(void) {
-  return( (((uint16_t)KT_regs[1] & 0x0007) << 8) | KT_regs[0] );
+  return(KT_getChannel() >> 1);
 }
 
-// Set gain (0: -12dB, ... , 3: 0dB, ... , 6: +12dB) 
-void KT_setGain(uint8_t gain) {
+// Load gain into register cache (0: -12dB, ... , 3: 0dB, ... , 6: +12dB)
+void KT_loadGain(uint8_t gain) {
   (gain <= 3) ? (gain = 3 - gain) : (gain++);
   KT_regs[1] = (KT_regs[1] & 0xc7) | ((gain & 0x07) << 3);
+}
+
+// Set gain (0: -12dB, ... , 3: 0dB, ... , 6: +12dB) 
+void KT_setGain(uint8_t gain) {
+  KT_loadGain(gain);
   KT_update();
 }
 
+// Load mute into register cache (0: unmute, 1: mute), kept muted while retuning
+void KT_loadMute(uint8_t mute) {
+  KT_mute = mute;
+  (mute || KT_busy) ? (KT_regs[2] |= 0x08) : (KT_regs[2] &= 0xf7);
+}
+
 // Set mude (0: unmute, 1: mute)
 void KT_setMute(uint8_t mute) {
-  (mute) ? (KT_regs[2] |= 0x08) : (KT_regs[2] &= 0xf7);
+  KT_loadMute(mute);
   KT_update();
 }
 
+// Load pre-emphasis time-constant depending on region into register cache
+void KT_loadRegion(uint8_t region) {
+  (region) ? (KT_regs[2] |= 0x01) : (KT_regs[2] &= 0xfe);
+}
+
 // Set pre-emphasis time-constant depending on region
 void KT_setRegion(uint8_t region) {
-  (region) ? (KT_regs[2] |= 0x01) : (KT_regs[2] &= 0xfe);
+  KT_loadRegion(region);
   KT_update();
 }
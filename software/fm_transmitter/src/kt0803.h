@@ -14,6 +14,28 @@
 // KT_setMute(m)          Set mude (0: unmute, 1: mute)
 // KT_setRegion(r)        Set region (0: USA/Japan, 1: Europe/Australia)
 //
+// KT_getChannel()        Get current channel (in 50kHz steps, 1977 means 98.85MHz)
+// KT_setChannel(ch)      Set channel (in 50kHz steps, 1977 means 98.85MHz)
+// KT_MHZ(f)              Convert frequency constant in MHz into channel (KT_MHZ(98.85))
+//
+// Click-free retuning:
+// --------------------
+// KT_retune(ch)          Request channel change (mute, set channel, wait for PLL,
+//                        unmute), successive requests are coalesced
+// KT_poll()              Process pending frequency change (call regularly)
+// KT_busy                1 while a frequency change is in progress
+//
+// Batched register updates:
+// --------------------------
+// KT_loadFreq(f)         Load frequency into register cache (no I2C transfer)
+// KT_loadChannel(ch)     Load channel into register cache (no I2C transfer)
+// KT_loadGain(g)         Load gain into register cache (no I2C transfer)
+// KT_loadMute(m)         Load mute into register cache (no I2C transfer)
+// KT_loadRegion(r)       Load region into register cache (no I2C transfer)
+// KT_update()            Write register cache to KT0803 in a single transaction
+//                        (queued with high priority if I2C_QUEUE > 0 in i2c_tx.h)
+// KT_send()              Write register cache to KT0803 immediately
+//
 // 2023 by Stefan Wagner: https://github.com/wagiminator
 
 #pragma once
@@ -26,13 +48,16 @@ extern "C" {
 
 // KT0802 parameters
 #define KT_INIT_I2C           0       // 1: init I2C with KT_init()
+#define KT_PLL_TIME           20      // PLL settling time after channel change in ms
+                                      // (not specified in the datasheet)
 
 // KT0802 I2C device address
 #define KT_I2C_ADDR           0x3e
 
-// Frequency range (in 100kHz)
-#define KT_FREQ_MIN           875
-#define KT_FREQ_MAX           1080
+// Channel range supported by KT0803K/L (in 50kHz, 76.0MHz - 108.0MHz)
+#define KT_CH_MIN             1520
+#define KT_CH_MAX             2160
+#define KT_MHZ(f)             ((uint16_t)((f) * 20 + 0.5))
 
 // Pre-emphasis time-constant depending on region
 #define KT_USA_JAPAN          0
@@ -45,6 +70,22 @@ void KT_setFreq(uint16_t freq);       // Set frequency (in 100kHz steps, 885 mea
 void KT_setGain(uint8_t gain);        // Set gain (0: -12dB, ... , 3: 0dB, ... , 6: +12dB)
 void KT_setMute(uint8_t mute);        // Set mude (0: unmute, 1: mute)
 void KT_setRegion(uint8_t region);    // Set pre-emphasis time-constant depending on region
+uint16_t KT_getChannel(void);         // Get current channel (in 50kHz steps)
+void KT_setChannel(uint16_t ch);      // Set channel (in 50kHz steps)
+
+// KT0802 Batch Functions (modify register cache only, apply with KT_update())
+void KT_update(void);                 // Write register cache to KT0803
+void KT_send(void);                   // Write register cache to KT0803 immediately
+void KT_loadFreq(uint16_t freq);      // Load frequency into register cache
+void KT_loadChannel(uint16_t ch);     // Load channel into register cache
+void KT_loadGain(uint8_t gain);       // Load gain into register cache
+void KT_loadMute(uint8_t mute);       // Load mute into register cache
+void KT_loadRegion(uint8_t region);   // Load region into register cache
+
+// KT0802 Retune Functions
+void KT_retune(uint16_t ch);          // Request channel change without audible glitches
+void KT_poll(void);                   // Process pending frequency change
+extern uint8_t KT_busy;               // 1 while a frequency change is in progress
 
 #ifdef __cplusplus
 };
@@ -0,0 +1,74 @@
+// ===================================================================================
+// Header-only C++ KT0803 K/L FM Transmitter Driver                           * v1.0 *
+// ===================================================================================
+//
+// C++ counterpart of the basic functions of kt0803.h (without the click-free
+// retuning), the bus is a template parameter.
+//
+// Usage:
+// ------
+// using Radio = Kt0803<Bus>;     // Bus, I2C address
+// Radio::init();                 // write default values (I2C must be initialized)
+// Radio::setChannel(ch);         // set channel (50kHz steps, Radio::MHz(98.85))
+// Radio::setGain(g);             // set gain (0: -12dB, ... , 3: 0dB, ... , 6: +12dB)
+// Radio::setMute(m);             // set mute (0: unmute, 1: mute)
+// Radio::setRegion(r);           // set region (0: USA/Japan, 1: Europe/Australia)
+// Radio::getChannel();           // get current channel
+//
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#pragma once
+
+#include <stdint.h>
+
+template<class Bus, uint8_t Addr = 0x3E>
+struct Kt0803 {
+  static inline uint8_t regs[3] = { 0x81, 0xC3, 0x41 }; // registers 0x00 - 0x02
+
+  // Convert frequency constant in MHz into channel (in 50kHz steps)
+  static constexpr uint16_t MHz(double f) { return (uint16_t)(f * 20 + 0.5); }
+
+  // Write register cache to KT0803
+  static void update(void) {
+    Bus::start(Addr << 1);
+    Bus::write(0);
+    Bus::writeBuffer(regs, 3);
+  }
+
+  // Setup KT0803
+  static void init(void) {
+    update();
+  }
+
+  // Set channel (in 50kHz steps)
+  static void setChannel(uint16_t ch) {
+    regs[0] = (uint8_t)(ch >> 1);
+    regs[1] = (regs[1] & 0xf8) | ((ch >> 9) & 0x07);
+    regs[2] = (regs[2] & 0x7f) | ((ch & 1) << 7);
+    update();
+  }
+
+  // Get current channel (in 50kHz steps)
+  static uint16_t getChannel(void) {
+    return (((uint16_t)regs[1] & 0x0007) << 9) | ((uint16_t)regs[0] << 1) | (regs[2] >> 7);
+  }
+
+  // Set gain (0: -12dB, ... , 3: 0dB, ... , 6: +12dB)
+  static void setGain(uint8_t gain) {
+    (gain <= 3) ? (gain = 3 - gain) : (gain++);
+    regs[1] = (regs[1] & 0xc7) | ((gain & 0x07) << 3);
+    update();
+  }
+
+  // Set mute (0: unmute, 1: mute)
+  static void setMute(uint8_t mute) {
+    mute ? (regs[2] |= 0x08) : (regs[2] &= 0xf7);
+    update();
+  }
+
+  // Set pre-emphasis time-constant depending on region
+  static void setRegion(uint8_t region) {
+    region ? (regs[2] |= 0x01) : (regs[2] &= 0xfe);
+    update();
+  }
+};
@@ -32,86 +32,258 @@
 #include <gpio.h>             // GPIO functions
 #include <kt0803.h>           // KT0803 functions
 #include <ssd1306_txt.h>      // OLED functions
+#include <uart.h>             // UART functions
+#include <band.h>             // FM band and channel step configuration
+#include <arith.h>            // multiply- and division-free arithmetic
+#include <menu.h>             // settings menu
 
 #define PIN_SW    PA2         // KT0803 switch on/off
 #define PIN_RST   PA1         // KT0803 reset (active low)
 #define PIN_KEYS  PC4         // Control keys
 
+#define SERIAL_CTRL   1       // 1: enable remote control via USART1 (see below)
+#define PLAN_ENABLE   1       // 1: enable scheduled channel plan (see below)
+#define STATUS_LINE   1       // 1: show status strip next to the frequency (see below)
+#define SETTINGS_MENU 1       // 1: settings menu, hold OK for one second (see below)
+#define PIXEL_SHIFT   1       // 1: move image by one pixel line every minute (see below)
+
+uint8_t  oled;                // 1: OLED found at boot
 uint8_t  display = 0;         // current display/control mode (0: frequency, 1: gain)
+uint8_t  menu = 0;            // 1: settings menu is open
 uint8_t  gain = 3;            // current gain (0..6)
-uint16_t freq = 988;          // current frequency (in 100kHz steps, 988 means 98.8Mhz) 
+uint16_t freq = KT_MHZ(98.8); // current frequency (channel in 50kHz steps, see kt0803.h)
+uint8_t  mute = 0;            // current mute state (0: unmute, 1: mute)
+uint8_t  region = KT_EUROPE_AUSTRALIA; // current pre-emphasis region
 
 // ===================================================================================
 // OLED Bitmaps
 // ===================================================================================
+// Compressed with tools/bitmap_rle.py, drawn with OLED_drawBitmapRLE(). "MHz" and "db"
+// are only the source for the display lists below and are removed by the linker.
 
-// "MHz" 44x32 pixel segment font
-const uint8_t OLED_MHZ[] = {
-  0xFC, 0xF9, 0xF3, 0x07, 0x07, 0xE7, 0xF7, 0xE7, 0x07, 0x07, 0xF3, 0xF9, 0xFC, 0x00, 0x00, 0x00,
-  0xFC, 0xF8, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF8, 0xFC, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x7F, 0x3F, 0x1F, 0x00, 0x00, 0x1F, 0x3F, 0x1F, 0x00, 0x00, 0x1F, 0x3F, 0x7F, 0x00, 0x00, 0x00,
-  0x7F, 0x3F, 0x9F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x9F, 0x3F, 0x7F, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 
-  0xFF, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFE, 0xFF, 0x00, 0x00, 0x00,
-  0xFF, 0xFE, 0xFC, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFC, 0xFE, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x81, 0xE1, 0xF9, 0x7D, 0x1D, 0x01, 0x00, 0x00, 0x00, 
-  0x1F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x1F, 0x00, 0x00, 0x00,
-  0x1F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x1F, 0x00, 0x00, 0x00,
-  0x40, 0x60, 0x76, 0x77, 0x73, 0x71, 0x70, 0x70, 0x70, 0x60, 0x40, 0x00
+// "MHz" 44x32 pixel segment font (run-length encoded)
+const uint8_t OLED_MHZ_RLE[] = {
+  0x0C, 0xFC, 0xF9, 0xF3, 0x07, 0x07, 0xE7, 0xF7, 0xE7, 0x07, 0x07, 0xF3, 0xF9, 0xFC, 0x80, 0x00,
+  0x02, 0xFC, 0xF8, 0xF0, 0x84, 0x00, 0x02, 0xF0, 0xF8, 0xFC, 0x8C, 0x00, 0x0C, 0x7F, 0x3F, 0x1F,
+  0x00, 0x00, 0x1F, 0x3F, 0x1F, 0x00, 0x00, 0x1F, 0x3F, 0x7F, 0x80, 0x00, 0x02, 0x7F, 0x3F, 0x9F,
+  0x84, 0xC0, 0x02, 0x9F, 0x3F, 0x7F, 0x81, 0x00, 0x00, 0x80, 0x84, 0xC0, 0x05, 0x80, 0x00, 0x00,
+  0xFF, 0xFE, 0xFC, 0x84, 0x00, 0x02, 0xFC, 0xFE, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFE, 0xFC, 0x84,
+  0x01, 0x02, 0xFC, 0xFE, 0xFF, 0x82, 0x00, 0x06, 0x01, 0x81, 0xE1, 0xF9, 0x7D, 0x1D, 0x01, 0x80,
+  0x00, 0x02, 0x1F, 0x0F, 0x07, 0x84, 0x00, 0x02, 0x07, 0x0F, 0x1F, 0x80, 0x00, 0x02, 0x1F, 0x0F,
+  0x07, 0x84, 0x00, 0x02, 0x07, 0x0F, 0x1F, 0x80, 0x00, 0x05, 0x40, 0x60, 0x76, 0x77, 0x73, 0x71,
+  0x80, 0x70, 0x02, 0x60, 0x40, 0x00
 };
 
-// "db" 29x32 pixel segment font
-const uint8_t OLED_DB[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF8, 0xFC, 0x00, 0x00, 0x00,
-  0xFC, 0xF8, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x9F, 0x3F, 0x7F, 0x00, 0x00, 0x00,
-  0x7F, 0x3F, 0x9F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 
-  0xFF, 0xFE, 0xFC, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFC, 0xFE, 0xFF, 0x00, 0x00, 0x00,
-  0xFF, 0xFE, 0xFC, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFC, 0xFE, 0xFF, 
-  0x1F, 0x4F, 0x67, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x67, 0x4F, 0x1F, 0x00, 0x00, 0x00,
-  0x1F, 0x4F, 0x67, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x67, 0x4F, 0x1F
+// "db" 29x32 pixel segment font (run-length encoded)
+const uint8_t OLED_DB_RLE[] = {
+  0x87, 0x00, 0x02, 0xF0, 0xF8, 0xFC, 0x80, 0x00, 0x02, 0xFC, 0xF8, 0xF0, 0x89, 0x00, 0x00, 0x80,
+  0x84, 0xC0, 0x02, 0x9F, 0x3F, 0x7F, 0x80, 0x00, 0x02, 0x7F, 0x3F, 0x9F, 0x84, 0xC0, 0x05, 0x80,
+  0x00, 0x00, 0xFF, 0xFE, 0xFC, 0x84, 0x01, 0x02, 0xFC, 0xFE, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFE,
+  0xFC, 0x84, 0x01, 0x05, 0xFC, 0xFE, 0xFF, 0x1F, 0x4F, 0x67, 0x84, 0x70, 0x02, 0x67, 0x4F, 0x1F,
+  0x80, 0x00, 0x02, 0x1F, 0x4F, 0x67, 0x84, 0x70, 0x02, 0x67, 0x4F, 0x1F
 };
 
-// "-" 13x32 pixel segment font
-const uint8_t OLED_MINUS[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+// "-" 13x32 pixel segment font (run-length encoded)
+const uint8_t OLED_MINUS_RLE[] = {
+  0x8C, 0x00, 0x00, 0x80, 0x84, 0xC0, 0x00, 0x80, 0x82, 0x00, 0x84, 0x01, 0x8D, 0x00
 };
 
-// "+" 13x32 pixel segment font
-const uint8_t OLED_PLUS[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xFC, 0xFE, 0xFC, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 
-  0x00, 0x00, 0x01, 0x01, 0x01, 0x1F, 0x3F, 0x1F, 0x01, 0x01, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+// "+" 13x32 pixel segment font (run-length encoded)
+const uint8_t OLED_PLUS_RLE[] = {
+  0x8B, 0x00, 0x00, 0x80, 0x80, 0xC0, 0x02, 0xFC, 0xFE, 0xFC, 0x80, 0xC0, 0x00, 0x80, 0x80, 0x00,
+  0x80, 0x01, 0x02, 0x1F, 0x3F, 0x1F, 0x80, 0x01, 0x8C, 0x00
 };
 
+// ===================================================================================
+// OLED Display Lists
+// ===================================================================================
+// Static parts of the screens right of the digits, compiled by tools/displaylist.py
+// from the bitmaps above with the arguments (in one line):
+//   src/main.c OLED_DL_FREQ @70,0,4 _13 OLED_MHZ_RLE/44 _1
+//              OLED_DL_FINE @86,0,3 _42 @86,3,1 _24 :MHz
+//              OLED_DL_GAIN @77,0,4 _21 OLED_DB_RLE/29 _1
+// With the status strip, the frequency screens leave its area free:
+//   src/main.c OLED_DL_FREQ @70,0,4 _16 @86,3,1 _24 :MHz
+//              OLED_DL_FINE @86,3,1 _24 :MHz
+
+#if STATUS_LINE > 0
+// OLED_DL_FREQ: 2 transaction(s), 106 data bytes -> 58 bytes
+const uint8_t OLED_DL_FREQ[] = {
+  OLED_DL_WINDOW( 70,  16, 0, 4), OLED_DL_RLE(64),
+  0xBD, 0x00,
+  OLED_DL_NEXT,
+  OLED_DL_WINDOW( 86,  42, 3, 1), OLED_DL_RLE(42),
+  0x96, 0x00, 0x06, 0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x00, 0x7F, 0x80, 0x08, 0x06, 0x7F, 0x00, 0x44,
+  0x64, 0x54, 0x4C, 0x44,
+  OLED_DL_END
+};
+
+// OLED_DL_FINE: 1 transaction(s), 42 data bytes -> 38 bytes
+const uint8_t OLED_DL_FINE[] = {
+  OLED_DL_WINDOW( 86,  42, 3, 1), OLED_DL_RLE(42),
+  0x96, 0x00, 0x06, 0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x00, 0x7F, 0x80, 0x08, 0x06, 0x7F, 0x00, 0x44,
+  0x64, 0x54, 0x4C, 0x44,
+  OLED_DL_END
+};
+#else
+// OLED_DL_FREQ: 1 transaction(s), 232 data bytes -> 156 bytes
+const uint8_t OLED_DL_FREQ[] = {
+  OLED_DL_WINDOW( 70,  58, 0, 4), OLED_DL_RLE(232),
+  0x8A, 0x00, 0x0C, 0xFC, 0xF9, 0xF3, 0x07, 0x07, 0xE7, 0xF7, 0xE7, 0x07, 0x07, 0xF3, 0xF9, 0xFC,
+  0x80, 0x00, 0x02, 0xFC, 0xF8, 0xF0, 0x84, 0x00, 0x02, 0xF0, 0xF8, 0xFC, 0x9A, 0x00, 0x0C, 0x7F,
+  0x3F, 0x1F, 0x00, 0x00, 0x1F, 0x3F, 0x1F, 0x00, 0x00, 0x1F, 0x3F, 0x7F, 0x80, 0x00, 0x02, 0x7F,
+  0x3F, 0x9F, 0x84, 0xC0, 0x02, 0x9F, 0x3F, 0x7F, 0x81, 0x00, 0x00, 0x80, 0x84, 0xC0, 0x00, 0x80,
+  0x8D, 0x00, 0x02, 0xFF, 0xFE, 0xFC, 0x84, 0x00, 0x02, 0xFC, 0xFE, 0xFF, 0x80, 0x00, 0x02, 0xFF,
+  0xFE, 0xFC, 0x84, 0x01, 0x02, 0xFC, 0xFE, 0xFF, 0x82, 0x00, 0x06, 0x01, 0x81, 0xE1, 0xF9, 0x7D,
+  0x1D, 0x01, 0x8E, 0x00, 0x02, 0x1F, 0x0F, 0x07, 0x84, 0x00, 0x02, 0x07, 0x0F, 0x1F, 0x80, 0x00,
+  0x02, 0x1F, 0x0F, 0x07, 0x84, 0x00, 0x02, 0x07, 0x0F, 0x1F, 0x80, 0x00, 0x05, 0x40, 0x60, 0x76,
+  0x77, 0x73, 0x71, 0x80, 0x70, 0x03, 0x60, 0x40, 0x00, 0x00,
+  OLED_DL_END
+};
+
+// OLED_DL_FINE: 2 transaction(s), 168 data bytes -> 58 bytes
+const uint8_t OLED_DL_FINE[] = {
+  OLED_DL_WINDOW( 86,  42, 0, 3), OLED_DL_RLE(126),
+  0xFB, 0x00,
+  OLED_DL_NEXT,
+  OLED_DL_WINDOW( 86,  42, 3, 1), OLED_DL_RLE(42),
+  0x96, 0x00, 0x06, 0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x00, 0x7F, 0x80, 0x08, 0x06, 0x7F, 0x00, 0x44,
+  0x64, 0x54, 0x4C, 0x44,
+  OLED_DL_END
+};
+#endif  // STATUS_LINE > 0
+
+// OLED_DL_GAIN: 1 transaction(s), 204 data bytes -> 99 bytes
+const uint8_t OLED_DL_GAIN[] = {
+  OLED_DL_WINDOW( 77,  51, 0, 4), OLED_DL_RLE(204),
+  0x9C, 0x00, 0x02, 0xF0, 0xF8, 0xFC, 0x80, 0x00, 0x02, 0xFC, 0xF8, 0xF0, 0x9F, 0x00, 0x00, 0x80,
+  0x84, 0xC0, 0x02, 0x9F, 0x3F, 0x7F, 0x80, 0x00, 0x02, 0x7F, 0x3F, 0x9F, 0x84, 0xC0, 0x00, 0x80,
+  0x95, 0x00, 0x02, 0xFF, 0xFE, 0xFC, 0x84, 0x01, 0x02, 0xFC, 0xFE, 0xFF, 0x80, 0x00, 0x02, 0xFF,
+  0xFE, 0xFC, 0x84, 0x01, 0x02, 0xFC, 0xFE, 0xFF, 0x93, 0x00, 0x02, 0x1F, 0x4F, 0x67, 0x84, 0x70,
+  0x02, 0x67, 0x4F, 0x1F, 0x80, 0x00, 0x02, 0x1F, 0x4F, 0x67, 0x84, 0x70, 0x03, 0x67, 0x4F, 0x1F,
+  0x00,
+  OLED_DL_END
+};
+
+// ===================================================================================
+// Status Strip
+// ===================================================================================
+// Gain, mute, supply voltage and region in the 5x8 font right of the frequency
+// digits (columns 86..127, lines 0..2). Each field is drawn only if its value has
+// changed since it was drawn last, independent of the frequency digits. The gain
+// screen covers the strip, so all fields are drawn again after it.
+//
+//   +12dB        gain
+//    MUTE        mute state
+//   3.3V EU      supply voltage, region (EU: Europe/Australia, US: USA/Japan)
+#if STATUS_LINE > 0
+
+#define STAT_X        86      // first column of the status strip
+#define STAT_VDD_TIME 1000    // time between supply voltage measurements in ms
+
+uint8_t  STAT_gain = 0xff;    // values shown (0xff: none)
+uint8_t  STAT_mute = 0xff, STAT_vdd = 0xff, STAT_region = 0xff;
+uint8_t  vdd;                 // supply voltage in 100mV
+uint32_t STAT_next;           // time of next supply voltage measurement
+
+// Mark all fields as not shown
+void STAT_clear(void) {
+  STAT_gain = 0xff; STAT_mute = 0xff; STAT_vdd = 0xff; STAT_region = 0xff;
+}
+
+// Measure supply voltage from time to time
+void STAT_measure(void) {
+  if((int32_t)(MIL_read() - STAT_next) < 0) return;
+  STAT_next += STAT_VDD_TIME;
+  vdd = ARITH_divu10(ARITH_divu10(ADC_read_VDD() + 50)); // mV -> 100mV (rounded)
+  ADC_input(PIN_KEYS);                            // back to keys
+}
+
+// Draw changed fields
+void STAT_update(void) {
+  uint8_t val;
+  if(display || menu || !oled) return;            // strip is covered or no OLED
+  STAT_measure();
+  if(STAT_gain == 0xff) {                         // nothing shown yet?
+    OLED_cursor(STAT_X, 0);
+    OLED_clearRect(42, 3);                        // clear strip
+  }
+  if(gain != STAT_gain) {                         // "+12dB"
+    STAT_gain = gain;
+    val = (gain < 3) ? 3 - gain : gain - 3;       // 4dB steps
+    OLED_cursor(STAT_X + 12, 0);
+    OLED_write(val ? ((gain < 3) ? '-' : '+') : ' ');
+    OLED_write(val == 3 ? '1' : ' ');
+    OLED_write("0482"[val]);
+    OLED_print("dB");
+  }
+  if(mute != STAT_mute) {                         // "MUTE"
+    STAT_mute = mute;
+    OLED_cursor(STAT_X + 18, 1);
+    if(mute) OLED_print("MUTE");
+    else     OLED_clearRect(24, 1);
+  }
+  if(vdd != STAT_vdd) {                           // "3.3V"
+    STAT_vdd = vdd;
+    val = ARITH_divu10(vdd);
+    OLED_cursor(STAT_X, 2);
+    OLED_write('0' + val);
+    OLED_write('.');
+    OLED_write('0' + vdd - ARITH_mul10(val));
+    OLED_write('V');
+  }
+  if(region != STAT_region) {                     // "EU"
+    STAT_region = region;
+    OLED_cursor(STAT_X + 30, 2);
+    OLED_print(region ? "EU" : "US");
+  }
+}
+
+#else
+#define STAT_clear()
+#define STAT_update()
+#endif  // STATUS_LINE > 0
+
 // ===================================================================================
 // OLED Update Function
 // ===================================================================================
+// Only the digits are drawn every time, the static part of the screen is sent only
+// if it is not shown already.
+const uint8_t* screen;        // display list currently shown
+
 void OLED_update(void) {
+  const uint8_t* list;
+  if(menu || !oled) return;                       // settings menu is shown or no OLED
   OLED_cursor(0, 0);
 
   // Display current volume gain level
   if(display) {
-    OLED_drawBitmap((gain < 3 ? OLED_MINUS : OLED_PLUS), 13, 4);
+    OLED_drawBitmapRLE((gain < 3 ? OLED_MINUS_RLE : OLED_PLUS_RLE), 13, 4);
     if      (gain == 3)                 OLED_printSegment( 0, 4, 1, 0);
     else if((gain == 0) || (gain == 6)) OLED_printSegment(12, 4, 1, 0);
     else if((gain == 1) || (gain == 5)) OLED_printSegment( 8, 4, 1, 0);
     else                                OLED_printSegment( 4, 4, 1, 0);
-    OLED_clearRect(21, 32);
-    OLED_drawBitmap(OLED_DB, 29, 4);
+    list = OLED_DL_GAIN;
+    STAT_clear();                                 // status strip is covered
   }
 
   // Display current transmitter frequency
+  // (50kHz resolution needs a fifth digit, the unit is then printed in small font)
+  else if(BAND_fine(freq)) {
+    OLED_printSegment((freq << 2) + freq, 5, 1, 2); // in 10kHz steps
+    list = OLED_DL_FINE;
+  }
   else {
-    OLED_printSegment(freq, 4, 1, 1);
-    OLED_clearRect(13, 32);
-    OLED_drawBitmap(OLED_MHZ, 44, 4);
+    OLED_printSegment(freq >> 1, 4, 1, 1);        // in 100kHz steps
+    list = OLED_DL_FREQ;
   }
+
+  // Draw static part if necessary
+  if(list != screen) {
+    OLED_drawList(list);
+    screen = list;
+  }
+  STAT_update();                                  // status strip (if fields changed)
 }
 
 // ===================================================================================
@@ -127,6 +299,388 @@ uint8_t KEY_read(void) {
   return ckey;
 }
 
+// ===================================================================================
+// Settings Menu
+// ===================================================================================
+// Holding OK for one second opens the menu (see menu.h for navigation). The display
+// timeout switches the OLED off if no key was pressed for the selected time, the
+// next key press only switches it on again.
+#if SETTINGS_MENU > 0
+
+#define SET_HOLD_TIME 100     // time to hold OK to open the menu in 10ms
+
+uint8_t  contrast = 3;        // OLED contrast level (0..7)
+uint8_t  timeout;             // display timeout (index into SET_TIMEOUT_MS)
+uint8_t  dark;                // 1: display was switched off by the timeout
+uint32_t SET_last;            // time of last key press
+
+const uint32_t SET_TIMEOUT_MS[] = { 0, 10000, 30000, 60000 };
+
+void SET_region(void)   { KT_setRegion(region); }
+void SET_mute(void)     { KT_setMute(mute); }
+void SET_contrast(void) { OLED_contrast((contrast << 5) | 0x1f); }
+
+const char* const SET_OFFON[]   = { "off", "on" };
+const char* const SET_REGION[]  = { "US", "EU" };
+const char* const SET_TIMEOUT[] = { "off", "10s", "30s", "60s" };
+
+const MENU_ITEM SET_MENU[] = {
+  { "Region",   &region,   1, SET_REGION,  SET_region   },
+  { "Mute",     &mute,     1, SET_OFFON,   SET_mute     },
+  { "Contrast", &contrast, 7, 0,           SET_contrast },
+  { "Timeout",  &timeout,  3, SET_TIMEOUT, 0            },
+  MENU_EXIT("Exit")
+};
+
+#define SET_NUM       (sizeof(SET_MENU) / sizeof(MENU_ITEM))
+
+// Open menu if OK is still held after SET_HOLD_TIME
+void SET_hold(void) {
+  uint8_t i = SET_HOLD_TIME;
+  if(!oled) return;                               // no menu without OLED
+  while((KEY_read() == KEY_OK) && i--) {
+    KT_poll();
+    DLY_ms(10);
+  }
+  if(KEY_read() != KEY_OK) return;
+  display = 0;
+  menu = 1;
+  MENU_open(SET_MENU, SET_NUM);
+}
+
+// Handle key in menu, redraw main screen when it is closed
+void SET_key(uint8_t key) {
+  if(MENU_key(key)) return;
+  menu = 0;
+  screen = 0;                                     // everything has to be drawn again
+  STAT_clear();
+  OLED_update();
+}
+
+// Display timeout, returns the key or KEY_NO if it only switched the display on
+uint8_t SET_wake(uint8_t key) {
+  if(key) {
+    SET_last = MIL_read();
+    if(dark) {
+      dark = 0;
+      OLED_display(1);
+      while(KEY_read()) KT_poll();
+      return KEY_NO;
+    }
+  }
+  else if(timeout && !dark && (MIL_read() - SET_last >= SET_TIMEOUT_MS[timeout])) {
+    dark = 1;
+    OLED_display(0);
+  }
+  return key;
+}
+
+#else
+#define SET_hold()
+#define SET_key(k)
+#define SET_wake(k)   (k)
+#endif  // SETTINGS_MENU > 0
+
+// ===================================================================================
+// Channel Plan (Scheduled Frequency Hopping)
+// ===================================================================================
+// When active, the transmitter steps through the entries of the table below. Each
+// entry is held for its dwell time; the next switching time is always calculated
+// from the previous one, so the schedule does not drift. Frequency changes are done
+// muted with KT_retune(). The plan is started/stopped with the serial command H1/H0
+// and stopped by manually changing the frequency.
+#if PLAN_ENABLE > 0
+
+// (8 bytes per entry, so indexing needs no multiplication)
+typedef struct {
+  uint32_t dwell;             // dwell time in milliseconds
+  uint16_t freq;              // frequency (channel in 50kHz steps)
+  uint8_t  gain;              // gain (0..6)
+} PLAN_ENTRY;
+
+const PLAN_ENTRY PLAN[] = {
+  {  60000, KT_MHZ( 88.1), 3 },
+  {  60000, KT_MHZ( 94.8), 3 },
+  {  60000, KT_MHZ(104.3), 3 }
+};
+
+#define PLAN_LEN      (sizeof(PLAN) / sizeof(PLAN_ENTRY))
+
+uint8_t  PLAN_active;         // 1: channel plan is running
+uint8_t  PLAN_idx;            // next plan entry
+uint32_t PLAN_next;           // time of next channel change in milliseconds
+
+// Start channel plan with the first entry
+void PLAN_start(void) {
+  PLAN_idx    = 0;
+  PLAN_next   = MIL_read();
+  PLAN_active = 1;
+}
+
+// Stop channel plan
+void PLAN_stop(void) {
+  PLAN_active = 0;
+}
+
+// Apply next plan entry if its time has come
+void PLAN_poll(void) {
+  if(!PLAN_active || ((int32_t)(MIL_read() - PLAN_next) < 0)) return;
+  freq = PLAN[PLAN_idx].freq;
+  gain = PLAN[PLAN_idx].gain;
+  PLAN_next += PLAN[PLAN_idx].dwell;
+  if(++PLAN_idx >= PLAN_LEN) PLAN_idx = 0;
+  KT_loadGain(gain);
+  KT_retune(freq);                                // retune muted if necessary
+  if(!KT_busy) KT_update();                       // otherwise write gain now
+  OLED_update();
+}
+
+#else
+#define PLAN_stop()
+#endif  // PLAN_ENABLE > 0
+
+// ===================================================================================
+// Serial Control Protocol
+// ===================================================================================
+// Text commands via USART1 (see uart.h for pins and baud rate). A command is a
+// single letter followed by a decimal value. Several commands can be sent in one
+// line separated by spaces; they are applied together with a single KT0803 register
+// update when the line is terminated by CR or LF. Every line is answered with the
+// current settings (e.g. "F98.80 G3 M0 R1") or with "ERR" if any command was invalid,
+// in which case nothing of the line is applied. A frequency must lie inside the band
+// selected at the end of the line; a band change alone moves the current frequency
+// to the nearest band limit.
+//
+// F<MHz>   set frequency (e.g. F98.85)     G<n>   set gain (0: -12dB .. 6: +12dB)
+// M<n>     set mute (0: off, 1: on)         R<n>   set region (0: USA/Japan, 1: EU)
+// B<n>     set band (see band.h)            W<n>   set step (0: 50, 1: 100, 2: 200kHz)
+// P<n>     recall preset n (0..3)           S<n>   store frequency/gain as preset n
+// H<n>     channel plan (0: stop, 1: start) ?      report current settings
+#if SERIAL_CTRL > 0
+
+#define CMD_PRESETS   4       // number of presets
+
+// Presets (frequency, gain)
+typedef struct {
+  uint16_t freq;
+  uint8_t  gain;
+} PRESET;
+
+PRESET CMD_preset[CMD_PRESETS] = {
+  { KT_MHZ( 88.1), 3 }, { KT_MHZ( 94.8), 3 }, { KT_MHZ( 98.8), 3 }, { KT_MHZ(104.3), 3 }
+};
+
+// Parser state
+uint8_t  CMD_cmd;             // current command letter (0: none)
+uint16_t CMD_val;             // current command value
+uint8_t  CMD_num;             // flag for value received
+uint8_t  CMD_dec;             // number of digits after decimal point (0xff: none)
+uint8_t  CMD_err;             // error flag for current line
+uint8_t  CMD_line;            // flag for line in progress
+uint16_t CMD_freq;            // pending frequency
+uint8_t  CMD_gain, CMD_mute, CMD_region; // pending settings
+uint8_t  CMD_plan;            // pending channel plan state
+uint8_t  CMD_band, CMD_step;  // pending band and channel step
+uint8_t  CMD_tune;            // flag for frequency set by the line (F or P)
+uint8_t  CMD_store;           // presets to be stored (bit n: preset n)
+PRESET   CMD_new[CMD_PRESETS]; // pending preset values
+
+// Highest frequency value by number of digits after the decimal point (108.00 MHz)
+const uint16_t CMD_FMAX[3] = { 108, 1080, 10800 };
+
+// Send value with decimal point at position (dp) counted from the right
+void CMD_printVal(uint16_t value, uint8_t dp) {
+  uint32_t bcd = ARITH_bcd(value) << 12;          // BCD, first digit in top nibble
+  uint8_t digits = 5;
+  uint8_t leadflag = 0;
+  while(digits--) {
+    char digitval = '0' + (bcd >> 28);
+    bcd <<= 4;
+    if(digitval != '0' || digits <= dp) leadflag = 1;
+    if(leadflag) UART_write(digitval);
+    if(dp && (digits == dp)) UART_write('.');
+  }
+}
+
+// Send current settings
+void CMD_report(void) {
+  UART_write('F'); CMD_printVal((freq << 2) + freq, 2);
+  UART_print(" G"); UART_write('0' + gain);
+  UART_print(" M"); UART_write('0' + mute);
+  UART_print(" R"); UART_write('0' + region);
+  UART_print(" B"); UART_write('0' + BAND_idx);
+  UART_print(" W"); UART_write('0' + BAND_stepIdx);
+  #if PLAN_ENABLE > 0
+  UART_print(" H"); UART_write('0' + PLAN_active);
+  #endif
+  UART_print("\r\n");
+}
+
+// Execute current command on pending settings
+void CMD_exec(void) {
+  uint16_t val = CMD_val;
+  uint16_t ch;
+  if(!CMD_cmd) return;
+  if((CMD_cmd != 'F') && (CMD_dec != 0xff)) CMD_err = 1; // only frequency has decimals
+  if((CMD_cmd != '?') && !CMD_num) CMD_err = 1;   // value is mandatory
+  switch(CMD_cmd) {
+    case 'F': if(CMD_dec == 0xff) CMD_dec = 0;
+              if(CMD_dec > 2) {CMD_err = 1; break;}  // 10kHz resolution
+              if(val > CMD_FMAX[CMD_dec]) {CMD_err = 1; break;} // scaling must not overflow
+              while(CMD_dec++ < 2) val = ARITH_mul10(val);
+              ch = ARITH_divu5(val);                // -> channel
+              if(val != (ch << 2) + ch) {CMD_err = 1; break;} // 50kHz channel grid
+              val = ch;
+              if((val < KT_CH_MIN) || (val > KT_CH_MAX)) CMD_err = 1;
+              else CMD_freq = val;
+              CMD_tune = 1;
+              CMD_plan = 0;
+              break;
+    case 'G': if(val > 6) CMD_err = 1; else CMD_gain = val; break;
+    case 'M': if(val > 1) CMD_err = 1; else CMD_mute = val; break;
+    case 'R': if(val > 1) CMD_err = 1; else CMD_region = val; break;
+    case 'B': if(val >= BAND_NUM) CMD_err = 1; else CMD_band = val; break;
+    case 'W': if(val >= STEP_NUM) CMD_err = 1; else CMD_step = val; break;
+    case 'P': if(val >= CMD_PRESETS) {CMD_err = 1; break;}
+              CMD_freq = CMD_preset[val].freq;
+              CMD_gain = CMD_preset[val].gain;
+              CMD_tune = 1;
+              CMD_plan = 0;
+              break;
+    case 'S': if(val >= CMD_PRESETS) {CMD_err = 1; break;}
+              CMD_new[val].freq = CMD_freq;         // stored by CMD_apply()
+              CMD_new[val].gain = CMD_gain;
+              CMD_store |= 1 << val;
+              break;
+    #if PLAN_ENABLE > 0
+    case 'H': if(val > 1) CMD_err = 1; else CMD_plan = val; break;
+    #endif
+    case '?': break;
+    default:  CMD_err = 1; break;
+  }
+  CMD_cmd = 0;
+}
+
+// Check pending frequency against the pending band: a frequency set by the line must
+// be inside, otherwise the current frequency is moved to the nearest band limit
+void CMD_limit(void) {
+  uint16_t min = BAND_min(CMD_band);
+  uint16_t max = BAND_max(CMD_band);
+  if((CMD_freq >= min) && (CMD_freq <= max)) return;
+  if(CMD_tune) CMD_err = 1;
+  else CMD_freq = (CMD_freq < min) ? min : max;
+}
+
+// Apply pending settings of a complete line with a single KT0803 update
+void CMD_apply(void) {
+  uint8_t i;
+  for(i=0; i<CMD_PRESETS; i++) {
+    if(CMD_store & (1 << i)) CMD_preset[i] = CMD_new[i];
+  }
+  #if PLAN_ENABLE > 0
+  if(CMD_plan != PLAN_active) {
+    if(CMD_plan) PLAN_start();
+    else         PLAN_stop();
+  }
+  #endif
+  uint8_t redraw = (CMD_freq != freq) || (CMD_gain != gain) || (CMD_step != BAND_stepIdx);
+  BAND_set(CMD_band);
+  BAND_setStep(CMD_step);
+  if(!redraw && (CMD_mute == mute) && (CMD_region == region)) return;
+  freq = CMD_freq; gain = CMD_gain; mute = CMD_mute; region = CMD_region;
+  KT_loadGain(gain);
+  KT_loadMute(mute);
+  KT_loadRegion(region);
+  KT_retune(freq);                                // retune muted if necessary
+  if(!KT_busy) KT_update();                       // otherwise write settings now
+  if(redraw) OLED_update();
+}
+
+// Process received characters
+void CMD_poll(void) {
+  while(UART_available()) {
+    char c = UART_read();
+    if((c == ' ') || (c == ';') || (c == '\r') || (c == '\n')) { // separator
+      CMD_exec();
+      if(CMD_line && ((c == '\r') || (c == '\n'))) { // end of non-empty line
+        if(!CMD_err) CMD_limit();
+        if(CMD_err) UART_print("ERR\r\n");
+        else {
+          CMD_apply();
+          CMD_report();
+        }
+        CMD_line = 0; CMD_err = 0;
+      }
+      continue;
+    }
+    if(!CMD_line) {                                 // start of a new line
+      CMD_line = 1;
+      CMD_freq = freq; CMD_gain = gain; CMD_mute = mute; CMD_region = region;
+      CMD_band = BAND_idx; CMD_step = BAND_stepIdx;
+      CMD_tune = 0; CMD_store = 0;
+      #if PLAN_ENABLE > 0
+      CMD_plan = PLAN_active;
+      #endif
+    }
+    if((c >= '0') && (c <= '9')) {                  // digit
+      if(!CMD_cmd || (CMD_val > 6553) || ((CMD_val == 6553) && (c > '5'))) CMD_err = 1;
+      CMD_val = ARITH_mul10(CMD_val) + (c - '0');
+      CMD_num = 1;
+      if(CMD_dec != 0xff) CMD_dec++;
+    }
+    else if(c == '.') {                             // decimal point
+      if(CMD_dec != 0xff) CMD_err = 1;
+      CMD_dec = 0;
+    }
+    else {                                          // command letter
+      CMD_exec();
+      if((c >= 'a') && (c <= 'z')) c -= 'a' - 'A'; // accept lower case
+      CMD_cmd = c; CMD_val = 0; CMD_num = 0; CMD_dec = 0xff;
+    }
+  }
+}
+#endif  // SERIAL_CTRL > 0
+
+// ===================================================================================
+// Burn-in Protection
+// ===================================================================================
+// The image is moved up and down by one pixel line in turns by changing the RAM line
+// shown at the top of the screen, nothing has to be drawn again. The RAM lines below
+// the screen that come into view are cleared once at boot. The SSD1306 cannot move
+// the image horizontally without rewriting the RAM (scrolling commands), so the
+// shift is vertical only.
+#if PIXEL_SHIFT > 0
+
+#define SHIFT_TIME    60000   // time between shifts in milliseconds
+
+const uint8_t SHIFT_LINE[] = { 0, 1, 0, 63 };     // centre, up, centre, down
+
+uint8_t  SHIFT_idx;           // current entry of SHIFT_LINE
+uint32_t SHIFT_next = SHIFT_TIME; // time of next shift in milliseconds
+
+// Shift image if its time has come
+void SHIFT_poll(void) {
+  if(!oled || (int32_t)(MIL_read() - SHIFT_next) < 0) return;
+  SHIFT_next += SHIFT_TIME;
+  OLED_startline(SHIFT_LINE[++SHIFT_idx & 3]);
+}
+
+#else
+#define SHIFT_poll()
+#endif  // PIXEL_SHIFT > 0
+
+// ===================================================================================
+// I2C Bus Sharing
+// ===================================================================================
+// The OLED redraw consists of many short I2C transactions. Between each of them the
+// pending KT0803 retune steps are processed and queued KT0803 writes are sent, so a
+// full-screen redraw does not delay the unmuting after a frequency change.
+#if I2C_QUEUE > 0
+void I2C_idle(void) {
+  KT_poll();
+}
+#endif
+
 // ===================================================================================
 // Main Function
 // ===================================================================================
@@ -148,22 +702,67 @@ int main(void) {
   ADC_init();
   ADC_slow();
   ADC_input(PIN_KEYS);
+  #if SERIAL_CTRL > 0
+  UART_init();
+  #endif
 
   // Setup external peripherals
-  OLED_init();
-  OLED_clear();
-  OLED_update();
+  oled = OLED_init();                 // init OLED, display stays off
+  if(oled) {
+    #if I2C_PROBE > 0
+    I2C_probeClock(OLED_DEV_ADDR);    // find fastest reliable clock rate for OLED
+    #endif
+    OLED_update();                    // first frame (covers the whole screen)
+    OLED_display(1);                  // switch display on when the frame is complete
+    #if PIXEL_SHIFT > 0
+    OLED_clearHidden();               // RAM lines shown when the image is shifted
+    #endif
+  }
+  #if SERIAL_CTRL > 0
+  else UART_print("OLED not found\r\n");  // transmitter keeps running without display
+  #endif
   DLY_ms(500);
-  KT_setFreq(freq);
+  KT_setChannel(freq);
   KT_setGain(gain);
 
   // Loop
   while(1) {
+    // Handle serial commands
+    #if SERIAL_CTRL > 0
+    CMD_poll();
+    #endif
+
+    // Handle channel plan
+    #if PLAN_ENABLE > 0
+    PLAN_poll();
+    #endif
+
+    // Move image against burn-in
+    SHIFT_poll();
+
+    // Handle pending frequency change, send queued KT0803 writes
+    KT_poll();
+    #if I2C_QUEUE > 0
+    I2C_flush();
+    #endif
+
+    // Update status strip
+    STAT_update();
+
     // Read current key
-    key = KEY_read();
+    key = SET_wake(KEY_read());
+
+    // Settings menu
+    if(menu) {
+      if(key) {
+        SET_key(key);
+        while(KEY_read()) KT_poll();
+        DLY_ms(10);
+      }
+    }
 
     // Volume gain display/control mode
-    if(display) {
+    else if(display) {
       switch(key) {
         case KEY_UP:    if(gain < 6) KT_setGain(++gain); break;
         case KEY_DOWN:  if(gain > 0) KT_setGain(--gain); break;
@@ -172,7 +771,7 @@ int main(void) {
       }
       if(key) {
         OLED_update();
-        while(KEY_read());
+        while(KEY_read()) KT_poll();
         DLY_ms(10);
       }
     }
@@ -180,18 +779,19 @@ int main(void) {
     // Transmitter frequency display/control mode
     else {
       switch(key) {
-        case KEY_UP:    freq++; break;
-        case KEY_DOWN:  freq--; break;
-        case KEY_OK:    display++; OLED_update(); while(KEY_read()); DLY_ms(10); break;
+        case KEY_UP:    freq = BAND_step(freq, 1); PLAN_stop(); break;
+        case KEY_DOWN:  freq = BAND_step(freq, 0); PLAN_stop(); break;
+        case KEY_OK:    display++; OLED_update(); SET_hold(); while(KEY_read()) KT_poll(); DLY_ms(10); break;
         default:        keydelay = 50; break;
       }
-      if(freq != KT_getFreq()) {
-        if(freq < KT_FREQ_MIN) freq = KT_FREQ_MAX;
-        if(freq > KT_FREQ_MAX) freq = KT_FREQ_MIN;
-        KT_setFreq(freq);
+      if((key == KEY_UP) || (key == KEY_DOWN)) {
+        KT_retune(freq);
         OLED_update();
         i = keydelay;
-        while((i--) && (KEY_read())) DLY_ms(10);
+        while((i--) && (KEY_read())) {
+          KT_poll();
+          DLY_ms(10);
+        }
         keydelay = 5;
       }
     }
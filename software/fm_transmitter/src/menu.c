@@ -0,0 +1,125 @@
+// ===================================================================================
+// Table-driven Settings Menu on SSD1306 OLED Text Functions                  * v1.0 *
+// ===================================================================================
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#include "menu.h"
+#include "arith.h"
+
+#define MENU_COLS     (OLED_WIDTH / 6)            // characters per line
+#define MENU_LABEL    (MENU_COLS - MENU_VAL_LEN - 2) // label field width in characters
+
+// Menu state
+const MENU_ITEM* MENU_items;  // item table
+uint8_t MENU_num;             // number of items
+uint8_t MENU_sel;             // selected item
+uint8_t MENU_top;             // first item on page
+uint8_t MENU_edit;            // 1: value of selected item is being edited
+
+// Print string padded with spaces to (len) characters
+void MENU_print(const char* str, uint8_t len) {
+  while(len--) OLED_write(*str ? *str++ : ' ');
+}
+
+// Draw selection marker of item (i)
+void MENU_drawMarker(uint8_t i) {
+  OLED_cursor(0, i - MENU_top);
+  OLED_write(i == MENU_sel ? '>' : ' ');
+}
+
+// Draw value field of item (i), inverted while editing
+void MENU_drawValue(uint8_t i) {
+  const MENU_ITEM* item = &MENU_items[i];
+  const char* str = "";
+  char buf[4];
+  if(item->value) {
+    if(item->names) str = item->names[*item->value];
+    else {                                        // number (0..255)
+      uint32_t bcd = ARITH_bcd(*item->value);
+      char* ptr = &buf[3];
+      *ptr = 0;
+      do {
+        *--ptr = '0' + (bcd & 0x0f);
+        bcd >>= 4;
+      } while(bcd);
+      str = ptr;
+    }
+  }
+  OLED_cursor(MENU_VAL_X, i - MENU_top);
+  OLED_textinvert(MENU_edit && (i == MENU_sel));
+  MENU_print(str, MENU_VAL_LEN);
+  OLED_textinvert(0);
+}
+
+// Draw whole page
+void MENU_drawPage(void) {
+  uint8_t i = MENU_top;
+  for(uint8_t line=0; line<MENU_LINES; line++, i++) {
+    if(i >= MENU_num) {                           // no item on this line
+      OLED_clearLine(line);
+      continue;
+    }
+    MENU_drawMarker(i);
+    OLED_write(' ');
+    MENU_print(MENU_items[i].label, MENU_LABEL);
+    MENU_drawValue(i);
+    OLED_clearRect(OLED_WIDTH - MENU_COLS * 6, 1); // rest of the line
+  }
+}
+
+// Open menu with table (items) of (n) entries, draw page
+void MENU_open(const MENU_ITEM* items, uint8_t n) {
+  MENU_items = items;
+  MENU_num   = n;
+  MENU_sel   = 0;
+  MENU_top   = 0;
+  MENU_edit  = 0;
+  MENU_drawPage();
+}
+
+// Handle key, returns 0 if the menu was closed
+uint8_t MENU_key(uint8_t key) {
+  const MENU_ITEM* item = &MENU_items[MENU_sel];
+  uint8_t old = MENU_sel;
+  uint8_t val;
+
+  // Start/end editing or close menu
+  if(key == MENU_OK) {
+    if(!item->value) return 0;                    // exit item
+    MENU_edit = !MENU_edit;
+    MENU_drawValue(MENU_sel);
+  }
+
+  // Change value
+  else if(MENU_edit) {
+    val = *item->value;
+    if     ((key == MENU_UP)   && (val < item->max)) val++;
+    else if((key == MENU_DOWN) && (val > 0))         val--;
+    if(val != *item->value) {
+      *item->value = val;
+      if(item->apply) item->apply();
+      MENU_drawValue(MENU_sel);
+    }
+  }
+
+  // Move selection, scroll page if necessary
+  else {
+    if     ((key == MENU_UP)   && (MENU_sel > 0))            MENU_sel--;
+    else if((key == MENU_DOWN) && (MENU_sel < MENU_num - 1)) MENU_sel++;
+    if(MENU_sel != old) {
+      if(MENU_sel < MENU_top) {
+        MENU_top = MENU_sel;
+        MENU_drawPage();
+      }
+      else if(MENU_sel >= MENU_top + MENU_LINES) {
+        MENU_top = MENU_sel - MENU_LINES + 1;
+        MENU_drawPage();
+      }
+      else {
+        MENU_drawMarker(old);
+        MENU_drawMarker(MENU_sel);
+      }
+    }
+  }
+  return 1;
+}
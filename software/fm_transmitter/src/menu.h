@@ -0,0 +1,63 @@
+// ===================================================================================
+// Table-driven Settings Menu on SSD1306 OLED Text Functions                  * v1.0 *
+// ===================================================================================
+//
+// The menu is described by a table of items, each showing a label and the value of
+// an 8-bit variable. A page of up to OLED_HEIGHT/8 items is drawn once when the menu
+// is opened or scrolled. After that only the field that changed is redrawn: the
+// selection marker when moving the selection, the value when editing it.
+//
+// Functions available:
+// --------------------
+// MENU_open(items,n)       Open menu with table (items) of (n) entries, draw page
+// MENU_key(k)              Handle key (k) (MENU_UP, MENU_OK, MENU_DOWN), returns 0
+//                          if the menu was closed, 1 otherwise
+//
+// Navigation:
+// -----------
+// UP/DOWN move the selection. OK on an item starts editing its value (shown
+// inverted), UP/DOWN then change the value within 0..max and the apply function of
+// the item is called after every change. OK ends editing. OK on an item without
+// variable (MENU_EXIT) closes the menu.
+//
+// Screen layout (one line per item, 5x8 font):
+// --------------------------------------------
+// > Label          Value
+//
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "ssd1306_txt.h"
+
+// Menu Parameters
+#define MENU_LINES      (OLED_HEIGHT / 8)   // number of items on one page
+#define MENU_VAL_LEN    5                   // width of the value field in characters
+#define MENU_VAL_X      (6 * (OLED_WIDTH / 6 - MENU_VAL_LEN)) // value field column
+
+// Keys (same order as the key ladder in main.c)
+enum { MENU_NO, MENU_UP, MENU_OK, MENU_DOWN };
+
+// Menu Item
+typedef struct {
+  const char*        label;   // label (up to 14 characters)
+  uint8_t*           value;   // variable (NULL: exit item)
+  uint8_t            max;     // value range 0..max
+  const char* const* names;   // names of the values (NULL: show as number)
+  void (*apply)(void);        // called after the value has changed (or NULL)
+} MENU_ITEM;
+
+#define MENU_EXIT(label)      { label, 0, 0, 0, 0 }
+
+// Menu Functions
+void MENU_open(const MENU_ITEM* items, uint8_t n);  // open menu, draw page
+uint8_t MENU_key(uint8_t key);                      // handle key, 0: menu closed
+
+#ifdef __cplusplus
+};
+#endif
@@ -0,0 +1,127 @@
+// ===================================================================================
+// Basic Print Functions                                                      * v1.0 *
+// ===================================================================================
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#include <stdarg.h>
+#include "print.h"
+
+// Powers of ten for the subtraction method
+static const uint32_t PRINT_DIVIDER[] = {
+  1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+// Print decimal value (BCD conversion by subtraction method). Leading zeros within
+// (width) digits are replaced by (fill), the others are skipped. A (sign) character
+// is printed in front of the first digit.
+static void printDec(void (*f)(char), uint32_t value, uint8_t width, char fill, char sign) {
+  uint8_t digits = 10;
+  uint8_t leadflag = 0;
+  if(sign && (fill == '0')) {                     // sign in front of leading zeros
+    f(sign);
+    sign = 0;
+  }
+  while(digits--) {
+    char digitval = '0';
+    uint32_t divider = PRINT_DIVIDER[digits];
+    while(value >= divider) {                     // subtract as long as it fits
+      digitval++;
+      value -= divider;
+    }
+    if(!leadflag && ((digitval != '0') || !digits)) {
+      leadflag = 1;                               // end of leading zeros
+      if(sign) f(sign);
+    }
+    if(leadflag) f(digitval);
+    else if(digits < width) f(fill);
+  }
+}
+
+// Print (bits) number of bits of value as hex (log = 2) or binary (log = 0) digits.
+// Leading zeros within (width) digits are replaced by (fill), the others are skipped.
+static void printDig(void (*f)(char), uint32_t value, uint8_t bits, uint8_t log,
+                     uint8_t width, char fill) {
+  uint8_t shift = 1 << log;                       // bits per digit
+  uint8_t mask  = (1 << shift) - 1;               // digit mask
+  uint8_t wbits = width << log;                   // field width in bits
+  uint8_t leadflag = 0;
+  while(bits) {
+    bits -= shift;
+    uint8_t digitval = (value >> bits) & mask;
+    if(digitval || !bits) leadflag = 1;           // end of leading zeros
+    if(leadflag) f(digitval < 10 ? digitval + '0' : digitval + 'A' - 10);
+    else if(bits < wbits) f(fill);
+  }
+}
+
+// Print decimal value
+void printD(void (*f)(char), uint32_t value) {
+  printDec(f, value, 0, 0, 0);
+}
+
+// Print 32-bit hex word value
+void printW(void (*f)(char), uint32_t value) {
+  printDig(f, value, 32, 2, 8, '0');
+}
+
+// Print 16-bit hex half-word value
+void printH(void (*f)(char), uint16_t value) {
+  printDig(f, value, 16, 2, 4, '0');
+}
+
+// Print 8-bit hex byte value
+void printB(void (*f)(char), uint8_t value) {
+  printDig(f, value, 8, 2, 2, '0');
+}
+
+// Print string
+void printS(void (*f)(char), const char* s) {
+  while(*s) f(*s++);
+}
+
+// Print string with newline
+void println(void (*f)(char), const char* s) {
+  printS(f, s);
+  f('\n');
+}
+
+// Simple printf (see print.h for supported formats)
+void printF(void (*f)(char), const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  while(*format) {
+    char c = *format++;
+    if(c != '%') {                                // normal character
+      f(c);
+      continue;
+    }
+    char fill = ' ';                              // field fill character
+    uint8_t width = 0;                            // field width
+    if(*format == '0') {
+      fill = '0';
+      format++;
+    }
+    while((*format >= '0') && (*format <= '9'))   // field width (width * 10 + digit)
+      width = (width << 3) + (width << 1) + (*format++ - '0');
+    switch(*format++) {
+      case 's': printS(f, va_arg(args, const char*)); break;
+      case 'c': f((char)va_arg(args, int)); break;
+      case 'u': printDec(f, va_arg(args, uint32_t), width, fill, 0); break;
+      case 'd': {
+                  int32_t value = va_arg(args, int32_t);
+                  if(value < 0) {
+                    if(width) width--;            // sign takes one character
+                    printDec(f, 0 - (uint32_t)value, width, fill, '-');
+                  }
+                  else printDec(f, value, width, fill, 0);
+                  break;
+                }
+      case 'x': printDig(f, va_arg(args, uint32_t), 32, 2, width, fill); break;
+      case 'b': printDig(f, va_arg(args, uint32_t), 32, 0, width, fill); break;
+      case '%': f('%'); break;
+      case 0:   format--; break;                  // end of format string
+      default:  break;                            // unsupported format
+    }
+  }
+  va_end(args);
+}
@@ -0,0 +1,44 @@
+// ===================================================================================
+// Basic Print Functions                                                      * v1.0 *
+// ===================================================================================
+//
+// Functions available:
+// --------------------
+// printD(f, n)             Print decimal value (32-bit unsigned)
+// printW(f, n)             Print 32-bit hex word value
+// printH(f, n)             Print 16-bit hex half-word value
+// printB(f, n)             Print  8-bit hex byte value
+// printS(f, s)             Print string
+// println(f, s)            Print string with newline
+// printF(f, s, ...)        Simple printf, supports:
+//                          %s (string), %c (char), %d (signed decimal), %u (unsigned
+//                          decimal), %x (upper-case hex), %b (binary), %% (percent
+//                          sign) and field width with space or zero fill (%5u, %02d)
+//
+// All functions stream the characters through the output function (f), e.g.
+// printD(UART_write, 1234) or printS(OLED_write, "Hello"), no buffer is needed.
+// Decimal conversion uses the subtraction method, hex and binary conversion use
+// shifts, so no multiplication or division routines are linked (RV32EC).
+//
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+// Print Functions
+void printD(void (*f)(char), uint32_t value);   // print decimal value
+void printW(void (*f)(char), uint32_t value);   // print 32-bit hex word value
+void printH(void (*f)(char), uint16_t value);   // print 16-bit hex half-word value
+void printB(void (*f)(char), uint8_t value);    // print 8-bit hex byte value
+void printS(void (*f)(char), const char* s);    // print string
+void println(void (*f)(char), const char* s);   // print string with newline
+void printF(void (*f)(char), const char* format, ...); // simple printf
+
+#ifdef __cplusplus
+};
+#endif
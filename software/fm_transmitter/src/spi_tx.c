@@ -0,0 +1,70 @@
+// ===================================================================================
+// Basic SPI Master Functions (write only) for CH32V003                       * v1.0 *
+// ===================================================================================
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#include "spi_tx.h"
+
+uint8_t SPI_deselect;                             // 1: deselect after transfer
+
+// Init SPI
+void SPI_init(void) {
+  // Setup GPIO pins: PC5 (SCK) and PC6 (MOSI) to alternate output, CS to output
+  RCC->APB2PCENR |= RCC_AFIOEN | RCC_IOPCEN | RCC_SPI1EN;
+  PIN_high(SPI_CS);                               // device not selected
+  PIN_output(SPI_CS);
+  PIN_alternate(PC5);
+  PIN_alternate(PC6);
+
+  // Setup TX DMA (SPI1_TX is hard-wired to DMA1 channel 3)
+  RCC->AHBPCENR |= RCC_DMA1EN;                    // enable DMA module clock
+  DMA1_Channel3->PADDR = (uint32_t)&SPI1->DATAR;  // peripheral address
+
+  // Setup and enable SPI (master, mode 0, 8-bit, software chip select)
+  SPI1->CTLR2 = SPI_CTLR2_TXDMAEN;                // DMA requests (channel decides)
+  SPI1->CTLR1 = SPI_CTLR1_MSTR | SPI_CTLR1_SSM | SPI_CTLR1_SSI
+              | (SPI_BR(SPI_CLKRATE) << 3)        // clock divider
+              | SPI_CTLR1_SPE;                    // enable SPI
+}
+
+// Wait until all bytes have been sent, deselect device if stop is pending
+void SPI_wait(void) {
+  if(DMA1_Channel3->CFGR & DMA_CFGR1_EN) {        // transfer running?
+    while(!(DMA1->INTFR & DMA_TCIF3));            // wait for transfer complete
+    DMA1->INTFCR = DMA_CGIF3;                     // clear flags
+    DMA1_Channel3->CFGR = 0;                      // disable channel
+  }
+  while(!(SPI1->STATR & SPI_STATR_TXE));          // wait for last byte in shifter
+  while(SPI1->STATR & SPI_STATR_BSY);             // wait for last byte sent
+  if(SPI_deselect) {
+    SPI_deselect = 0;
+    PIN_high(SPI_CS);                             // deselect device
+  }
+}
+
+// Start transmission: wait until idle, select device
+void SPI_start(void) {
+  SPI_wait();
+  PIN_low(SPI_CS);
+}
+
+// Transmit one data byte (polled)
+void SPI_write(uint8_t data) {
+  while(!(SPI1->STATR & SPI_STATR_TXE));          // wait for free buffer
+  SPI1->DATAR = data;                             // send data byte
+}
+
+// Send buffer via DMA, returns at once
+void SPI_writeDMA(const uint8_t* buf, uint16_t len) {
+  SPI_wait();                                     // previous buffer sent?
+  DMA1_Channel3->MADDR = (uint32_t)buf;           // memory address
+  DMA1_Channel3->CNTR  = len;                     // number of bytes
+  DMA1_Channel3->CFGR  = DMA_CFGR1_MINC           // increment memory address
+                       | DMA_CFGR1_DIR            // memory to peripheral
+                       | DMA_CFGR1_EN;            // enable channel
+}
+
+// Deselect device when the last byte has been sent
+void SPI_stop(void) {
+  SPI_deselect = 1;
+}
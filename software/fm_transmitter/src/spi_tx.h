@@ -0,0 +1,58 @@
+// ===================================================================================
+// Basic SPI Master Functions (write only) for CH32V003                       * v1.0 *
+// ===================================================================================
+//
+// Uses the hardware SPI1 module (SCK: PC5, MOSI: PC6) in mode 0, MSB first, with a
+// software controlled chip select pin (SPI_CS). MISO is not used.
+//
+// Functions available:
+// --------------------
+// SPI_init()               Init SPI with clock rate not above SPI_CLKRATE
+// SPI_start()              Start transmission (wait until idle, select device)
+// SPI_write(b)             Transmit one data byte via SPI (polled)
+// SPI_writeDMA(buf,len)    Send buffer (*buf) with length (len) via DMA, returns at
+//                          once (buffer must stay valid until the next
+//                          SPI_writeDMA() or SPI_wait())
+// SPI_stop()               Deselect device when the last byte has been sent
+// SPI_wait()               Wait until all bytes have been sent (and deselect device
+//                          if SPI_stop() was called)
+//
+// SPI1_TX is hard-wired to DMA1 channel 3. Several buffers can be sent one after
+// another in one transmission, each SPI_writeDMA() waits for the previous one, so
+// the next buffer can be filled while the last one is being sent.
+//
+// SPI_BR(rate) returns the baud rate bits of the smallest divider (F_CPU / 2 .. 256)
+// for a clock not above (rate), folded into a constant at compile time.
+//
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "system.h"
+#include "gpio.h"
+
+// SPI Parameters
+#define SPI_CLKRATE   8000000   // maximum SPI clock rate (Hz), SSD1306: 10MHz
+#define SPI_CS        PC0       // chip select pin (active low)
+
+// SPI clock divider (see above)
+#define SPI_BR(r)     ((F_CPU /   2 <= (r)) ? 0 : (F_CPU /   4 <= (r)) ? 1 : \
+                       (F_CPU /   8 <= (r)) ? 2 : (F_CPU /  16 <= (r)) ? 3 : \
+                       (F_CPU /  32 <= (r)) ? 4 : (F_CPU /  64 <= (r)) ? 5 : \
+                       (F_CPU / 128 <= (r)) ? 6 : 7)
+
+// SPI Functions
+void SPI_init(void);            // SPI init function
+void SPI_start(void);           // start transmission, select device
+void SPI_write(uint8_t data);   // transmit one data byte (polled)
+void SPI_writeDMA(const uint8_t* buf, uint16_t len); // send buffer via DMA, no wait
+void SPI_stop(void);            // deselect device after last byte
+void SPI_wait(void);            // wait until all bytes have been sent
+
+#ifdef __cplusplus
+};
+#endif
@@ -0,0 +1,138 @@
+// ===================================================================================
+// Header-only C++ SSD1306/SH1106 I2C OLED Driver                             * v1.0 *
+// ===================================================================================
+//
+// C++ counterpart of the control and bitmap functions of ssd1306_txt.h. Bus, size,
+// address, controller type and orientation are template parameters, so the init
+// sequence and the screen offsets are constants. Command codes, OLED_BOOT_TIME,
+// OLED_INVERT and OLED_INIT_ON are taken from ssd1306_txt.h, so both drivers send
+// the same byte stream (checked by 'make compare-host').
+//
+// Usage:
+// ------
+// using Display = Oled<Bus, 128, 32>;  // Bus, width, height, address, SH1106, flip
+// Display::init();                     // init OLED (I2C must be initialized), on
+//                                      // with display(1) if OLED_INIT_ON is 0
+// Display::display(v)                  // switch display on/off
+// Display::contrast(v)                 // set display contrast (0-255)
+// Display::clear()                     // clear screen
+// Display::cursor(x,y)                 // set cursor (x: 0-127, y: page 0-7)
+// Display::drawBitmap(bmp,w,h)         // draw bitmap (w: pixels, h: 8-pixel lines)
+// Display::clearRect(w,h)              // clear rectangle at cursor position
+//
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#pragma once
+
+#include <stdint.h>
+#include "system.h"
+#include "ssd1306_txt.h"
+
+template<class Bus, uint8_t Width = 128, uint8_t Height = 32, uint8_t Addr = 0x3C,
+         bool SH1106 = false, bool Flip = true>
+struct Oled {
+  static constexpr uint8_t PAGES = Height / 8;
+  static constexpr uint8_t XOFF  = ((128 - Width) >> 1) + (SH1106 ? 2 : 0);
+  static constexpr uint8_t CMD   = OLED_CMD_MODE; // command mode
+  static constexpr uint8_t DAT   = OLED_DAT_MODE; // data mode
+
+  static inline uint8_t x, y;                     // cursor position
+
+  // Init OLED
+  static void init(void) {
+    static const uint8_t INIT_CMD[] = {
+      OLED_MULTIPLEX,  Height - 1,                // set multiplex ratio
+      OLED_CHARGEPUMP, 0x14,                      // set DC-DC enable
+      OLED_MEMORYMODE, 0x00,                      // set horizontal addressing mode
+      OLED_COMPINS,    (Width == 128 && Height == 32) ? 0x02 : 0x12, // set com pins
+      Flip ? OLED_XFLIP_ON : OLED_XFLIP_OFF,      // flip screen in X-direction
+      Flip ? OLED_YFLIP_ON : OLED_YFLIP_OFF,      // flip screen in Y-direction
+      #if OLED_INVERT > 0
+      OLED_INVERT_ON,                             // invert screen
+      #endif
+      #if OLED_INIT_ON > 0
+      OLED_DISPLAY_ON                             // display on
+      #endif
+    };
+    #if OLED_BOOT_TIME > 0
+    DLY_ms(OLED_BOOT_TIME);                       // time for the OLED to boot up
+    #endif
+    Bus::start(Addr << 1);
+    Bus::write(CMD);
+    Bus::writeBuffer(INIT_CMD, sizeof(INIT_CMD));
+  }
+
+  // Send one command byte
+  static void command(uint8_t cmd) {
+    Bus::start(Addr << 1);
+    Bus::write(CMD);
+    Bus::write(cmd);
+    Bus::stop();
+  }
+
+  // Switch display on/off (0: display off, 1: display on)
+  static void display(uint8_t val) {
+    command(val ? OLED_DISPLAY_ON : OLED_DISPLAY_OFF);
+  }
+
+  // Set display contrast (0-255)
+  static void contrast(uint8_t val) {
+    Bus::start(Addr << 1);
+    Bus::write(CMD);
+    Bus::write(OLED_CONTRAST);
+    Bus::write(val);
+    Bus::stop();
+  }
+
+  // Set cursor position (x: 0-127, y: page 0-7)
+  static void cursor(uint8_t xpos, uint8_t ypos) {
+    if(ypos >= PAGES) ypos = 0;                   // limit y
+    x = xpos; y = ypos;
+    xpos += XOFF;                                 // add offset
+    Bus::start(Addr << 1);
+    Bus::write(CMD);
+    Bus::write(OLED_PAGE + ypos);                 // set page
+    Bus::write(xpos & 0x0F);                      // set column
+    Bus::write((xpos >> 4) | 0x10);
+    Bus::stop();
+  }
+
+  // Clear screen (last page first, cursor at line start before and after, as the C
+  // driver does)
+  static void clear(void) {
+    for(uint8_t page=PAGES; page--; ) {
+      cursor(0, page);
+      Bus::start(Addr << 1);
+      Bus::write(DAT);
+      for(uint8_t i=Width; i; i--) Bus::write(0x00);
+      Bus::stop();
+      cursor(0, page);
+    }
+  }
+
+  // Draw bitmap at cursor position, width (w) in pixels, height (h) in 8-pixel lines
+  static void drawBitmap(const uint8_t* bmp, uint8_t w, uint8_t h) {
+    uint8_t ypos = y;
+    while(h--) {
+      Bus::start(Addr << 1);
+      Bus::write(DAT);
+      for(uint8_t i=w; i; i--) Bus::write(*bmp++);
+      Bus::stop();
+      cursor(x, y + 1);                           // set next line
+    }
+    cursor(x + w, ypos);                          // move cursor
+  }
+
+  // Clear rectangle at cursor position
+  static void clearRect(uint8_t w, uint8_t h) {
+    uint8_t ypos = y;
+    while(h--) {
+      Bus::start(Addr << 1);
+      Bus::write(DAT);
+      for(uint8_t i=w; i; i--) Bus::write(0x00);
+      Bus::stop();
+      cursor(x, y + 1);                           // set next line
+    }
+    cursor(x + w, ypos);                          // move cursor
+  }
+};
@@ -0,0 +1,213 @@
+// ===================================================================================
+// SSD1306 OLED Big Fonts (5x16, 10x16) for OLED_BIGCHARS = 2
+// ===================================================================================
+//
+// Generated by tools/bigfont.py from OLED_FONT, do not edit.
+//
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#include "ssd1306_txt.h"
+
+#if OLED_BIGCHARS == 2
+
+// 5x16 font (chars 32 - 127), 10 bytes per character: upper page, lower page
+const uint8_t OLED_FONT_5X16[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // space
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, // !
+  0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // "
+  0x30, 0xFF, 0x30, 0xFF, 0x30, 0x03, 0x3F, 0x03, 0x3F, 0x03, // #
+  0x30, 0xCC, 0xFF, 0xCC, 0x0C, 0x0C, 0x0C, 0x3F, 0x0C, 0x03, // $
+  0x0F, 0x0F, 0xC0, 0x30, 0x0C, 0x0C, 0x03, 0x00, 0x3C, 0x3C, // %
+  0x3C, 0xC3, 0x33, 0x0C, 0x00, 0x0F, 0x30, 0x33, 0x0C, 0x33, // &
+  0x00, 0x30, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '
+  0x00, 0xF0, 0x0C, 0x03, 0x00, 0x00, 0x03, 0x0C, 0x30, 0x00, // (
+  0x00, 0x03, 0x0C, 0xF0, 0x00, 0x00, 0x30, 0x0C, 0x03, 0x00, // )
+  0x30, 0xC0, 0xFC, 0xC0, 0x30, 0x03, 0x00, 0x0F, 0x00, 0x03, // *
+  0xC0, 0xC0, 0xFC, 0xC0, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, // +
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3C, 0x00, 0x00, // ,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, // -
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, // .
+  0x00, 0x00, 0xC0, 0x30, 0x0C, 0x0C, 0x03, 0x00, 0x00, 0x00, // /
+  0xFC, 0x03, 0xC3, 0x33, 0xFC, 0x0F, 0x33, 0x30, 0x30, 0x0F, // 0
+  0x30, 0x0C, 0xFF, 0x00, 0x00, 0x30, 0x30, 0x3F, 0x30, 0x30, // 1
+  0x0C, 0x03, 0x03, 0xC3, 0x3C, 0x30, 0x3C, 0x33, 0x30, 0x30, // 2
+  0x0C, 0x03, 0xC3, 0xC3, 0x3C, 0x0C, 0x30, 0x30, 0x30, 0x0F, // 3
+  0xC0, 0x30, 0x0C, 0xFF, 0x00, 0x03, 0x03, 0x03, 0x3F, 0x03, // 4
+  0xFF, 0xC3, 0xC3, 0xC3, 0x03, 0x0C, 0x30, 0x30, 0x30, 0x0F, // 5
+  0xFC, 0xC3, 0xC3, 0xC3, 0x0C, 0x0F, 0x30, 0x30, 0x30, 0x0F, // 6
+  0x0F, 0x03, 0x03, 0xC3, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, // 7
+  0x3C, 0xC3, 0xC3, 0xC3, 0x3C, 0x0F, 0x30, 0x30, 0x30, 0x0F, // 8
+  0x3C, 0xC3, 0xC3, 0xC3, 0xFC, 0x0C, 0x30, 0x30, 0x30, 0x0F, // 9
+  0x00, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, // :
+  0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x3C, 0x00, 0x00, // ;
+  0x00, 0xC0, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x03, 0x0C, 0x00, // <
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x03, 0x03, 0x03, 0x03, 0x03, // =
+  0x00, 0x0C, 0x30, 0xC0, 0x00, 0x00, 0x0C, 0x03, 0x00, 0x00, // >
+  0x0C, 0x03, 0x03, 0xC3, 0x3C, 0x00, 0x00, 0x33, 0x00, 0x00, // ?
+  0xFC, 0x03, 0xF3, 0x33, 0xFC, 0x0F, 0x30, 0x33, 0x33, 0x33, // @
+  0xF0, 0x0C, 0x03, 0x0C, 0xF0, 0x3F, 0x03, 0x03, 0x03, 0x3F, // A
+  0xFF, 0xC3, 0xC3, 0xC3, 0x3C, 0x3F, 0x30, 0x30, 0x30, 0x0F, // B
+  0xFC, 0x03, 0x03, 0x03, 0x0C, 0x0F, 0x30, 0x30, 0x30, 0x0C, // C
+  0xFF, 0x03, 0x03, 0x0C, 0xF0, 0x3F, 0x30, 0x30, 0x0C, 0x03, // D
+  0xFF, 0xC3, 0xC3, 0xC3, 0x03, 0x3F, 0x30, 0x30, 0x30, 0x30, // E
+  0xFF, 0xC3, 0xC3, 0xC3, 0x03, 0x3F, 0x00, 0x00, 0x00, 0x00, // F
+  0xFC, 0x03, 0xC3, 0xC3, 0xCC, 0x0F, 0x30, 0x30, 0x30, 0x0F, // G
+  0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x3F, // H
+  0x03, 0x03, 0xFF, 0x03, 0x03, 0x30, 0x30, 0x3F, 0x30, 0x30, // I
+  0x00, 0x00, 0x03, 0xFF, 0x03, 0x0C, 0x30, 0x30, 0x0F, 0x00, // J
+  0xFF, 0xC0, 0x30, 0x0C, 0x03, 0x3F, 0x00, 0x03, 0x0C, 0x30, // K
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x30, 0x30, 0x30, 0x30, // L
+  0xFF, 0x0C, 0xF0, 0x0C, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x3F, // M
+  0xFF, 0x30, 0xC0, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x03, 0x3F, // N
+  0xFC, 0x03, 0x03, 0x03, 0xFC, 0x0F, 0x30, 0x30, 0x30, 0x0F, // O
+  0xFF, 0xC3, 0xC3, 0xC3, 0x3C, 0x3F, 0x00, 0x00, 0x00, 0x00, // P
+  0xFC, 0x03, 0x03, 0x03, 0xFC, 0x0F, 0x30, 0x30, 0xF0, 0xCF, // Q
+  0xFF, 0xC3, 0xC3, 0xC3, 0x3C, 0x3F, 0x00, 0x03, 0x0C, 0x30, // R
+  0x3C, 0xC3, 0xC3, 0xC3, 0x0C, 0x0C, 0x30, 0x30, 0x30, 0x0F, // S
+  0x03, 0x03, 0xFF, 0x03, 0x03, 0x00, 0x00, 0x3F, 0x00, 0x00, // T
+  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x30, 0x30, 0x30, 0x0F, // U
+  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x0C, 0x30, 0x0C, 0x03, // V
+  0xFF, 0x00, 0xC0, 0x00, 0xFF, 0x0F, 0x30, 0x0F, 0x30, 0x0F, // W
+  0x0F, 0x30, 0xC0, 0x30, 0x0F, 0x3C, 0x03, 0x00, 0x03, 0x3C, // X
+  0x3F, 0xC0, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, // Y
+  0x03, 0x03, 0xC3, 0x33, 0x0F, 0x3C, 0x33, 0x30, 0x30, 0x30, // Z
+  0x00, 0xFF, 0x03, 0x03, 0x00, 0x00, 0x3F, 0x30, 0x30, 0x00, // [
+  0x0C, 0x30, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, // backslash
+  0x00, 0x03, 0x03, 0xFF, 0x00, 0x00, 0x30, 0x30, 0x3F, 0x00, // ]
+  0xC0, 0x30, 0x0C, 0x30, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, // ^
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, // _
+  0x00, 0x3C, 0xC3, 0xC3, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, // `
+  0x00, 0x30, 0x30, 0x30, 0xC0, 0x0C, 0x33, 0x33, 0x33, 0x3F, // a
+  0xFF, 0x30, 0x30, 0x30, 0xC0, 0x3F, 0x30, 0x30, 0x30, 0x0F, // b
+  0xC0, 0x30, 0x30, 0x30, 0xC0, 0x0F, 0x30, 0x30, 0x30, 0x0C, // c
+  0xC0, 0x30, 0x30, 0x30, 0xFF, 0x0F, 0x30, 0x30, 0x30, 0x3F, // d
+  0xC0, 0x30, 0x30, 0x30, 0xC0, 0x0F, 0x33, 0x33, 0x33, 0x03, // e
+  0xC0, 0xFC, 0xC3, 0x03, 0x0C, 0x00, 0xFF, 0x00, 0x00, 0x00, // f
+  0xC0, 0x30, 0x30, 0x30, 0xC0, 0x03, 0xCC, 0xCC, 0xCC, 0x3F, // g
+  0xFF, 0x30, 0x30, 0x30, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x3F, // h
+  0x00, 0x30, 0xF3, 0x00, 0x00, 0x00, 0x30, 0x3F, 0x30, 0x00, // i
+  0x00, 0x00, 0x30, 0xF3, 0x00, 0x00, 0xC0, 0xC0, 0x3F, 0x00, // j
+  0x03, 0xFF, 0x00, 0xC0, 0x30, 0x30, 0x3F, 0x03, 0x0C, 0x30, // k
+  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x30, 0x3F, 0x30, 0x00, // l
+  0xF0, 0x30, 0xF0, 0x30, 0xC0, 0x3F, 0x00, 0x3F, 0x00, 0x3F, // m
+  0xF0, 0x30, 0x30, 0x30, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x3F, // n
+  0xC0, 0x30, 0x30, 0x30, 0xC0, 0x0F, 0x30, 0x30, 0x30, 0x0F, // o
+  0xF0, 0x30, 0x30, 0x30, 0xC0, 0xFF, 0x0C, 0x0C, 0x0C, 0x03, // p
+  0xC0, 0x30, 0x30, 0x30, 0xF0, 0x03, 0x0C, 0x0C, 0x0C, 0xFF, // q
+  0xF0, 0xC0, 0x30, 0x30, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, // r
+  0xC0, 0x30, 0x30, 0x30, 0x00, 0x00, 0x33, 0x33, 0x33, 0x0C, // s
+  0x30, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x0F, 0x30, 0x30, 0x0C, // t
+  0xF0, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x30, 0x30, 0x30, 0x0F, // u
+  0xF0, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x0C, 0x30, 0x0C, 0x03, // v
+  0xF0, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x30, 0x0F, 0x30, 0x0F, // w
+  0x30, 0xC0, 0x00, 0xC0, 0x30, 0x30, 0x0C, 0x03, 0x0C, 0x30, // x
+  0xF0, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xCC, 0xCC, 0xCC, 0x3F, // y
+  0x30, 0x30, 0x30, 0xF0, 0x30, 0x30, 0x3C, 0x33, 0x30, 0x30, // z
+  0xC0, 0xC0, 0x3C, 0x03, 0x03, 0x00, 0x00, 0x0F, 0x30, 0x30, // {
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, // |
+  0x03, 0x03, 0x3C, 0xC0, 0xC0, 0x30, 0x30, 0x0F, 0x00, 0x00, // }
+  0xC0, 0x30, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x03, 0x00, // ~
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF  // 0x7F
+};
+
+// 10x16 smoothed font (chars 32 - 127), 20 bytes per character: upper page, lower page
+const uint8_t OLED_FONT_10X16[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // space
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, // !
+  0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // "
+  0x30, 0x30, 0xFF, 0xFF, 0x30, 0x30, 0xFF, 0xFF, 0x30, 0x30, 0x03, 0x03, 0x3F, 0x3F, 0x03, 0x03, 0x3F, 0x3F, 0x03, 0x03, // #
+  0x30, 0x78, 0xFC, 0xCC, 0xFF, 0xFF, 0xCC, 0xCC, 0x8C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x3F, 0x3F, 0x0C, 0x0F, 0x07, 0x03, // $
+  0x0F, 0x0F, 0x0F, 0x8F, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0C, 0x0C, 0x0E, 0x07, 0x03, 0x01, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, // %
+  0x3C, 0xFE, 0xE7, 0xE3, 0xF3, 0x3F, 0x1E, 0x0C, 0x00, 0x00, 0x0F, 0x1F, 0x39, 0x31, 0x33, 0x3F, 0x1E, 0x1E, 0x3F, 0x33, // &
+  0x00, 0x00, 0x30, 0x38, 0x1F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '
+  0x00, 0x00, 0xF0, 0xF8, 0x1C, 0x0E, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0x30, 0x00, 0x00, // (
+  0x00, 0x00, 0x03, 0x07, 0x0E, 0x1C, 0xF8, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x30, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x00, 0x00, // )
+  0x30, 0xF0, 0xE0, 0xC0, 0xFC, 0xFC, 0xC0, 0xE0, 0xF0, 0x30, 0x03, 0x03, 0x01, 0x00, 0x0F, 0x0F, 0x00, 0x01, 0x03, 0x03, // *
+  0xC0, 0xC0, 0xC0, 0xC0, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, // +
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0x7C, 0x3C, 0x00, 0x00, 0x00, 0x00, // ,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // -
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, // .
+  0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0C, 0x0C, 0x0E, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, // /
+  0xFC, 0xFE, 0x07, 0x83, 0xC3, 0xE3, 0x73, 0x37, 0xFE, 0xFC, 0x0F, 0x1F, 0x3B, 0x33, 0x31, 0x30, 0x30, 0x38, 0x1F, 0x0F, // 0
+  0x30, 0x38, 0x1C, 0x0C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, // 1
+  0x0C, 0x0E, 0x07, 0x03, 0x03, 0x83, 0xC3, 0xE7, 0x7E, 0x3C, 0x30, 0x30, 0x3C, 0x3E, 0x37, 0x33, 0x31, 0x30, 0x30, 0x30, // 2
+  0x0C, 0x0E, 0x07, 0x03, 0xC3, 0xC3, 0xC3, 0xE7, 0xFE, 0x3C, 0x0C, 0x1C, 0x38, 0x30, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0F, // 3
+  0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0C, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3F, 0x3F, 0x03, 0x03, // 4
+  0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x83, 0x03, 0x0C, 0x1C, 0x38, 0x30, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0F, // 5
+  0xFC, 0xFE, 0xC7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0x8E, 0x0C, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0F, // 6
+  0x0F, 0x0F, 0x03, 0x03, 0x03, 0x83, 0xC3, 0xE3, 0x7F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x01, 0x00, 0x00, 0x00, // 7
+  0x3C, 0xFE, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0xFE, 0x3C, 0x0F, 0x1F, 0x39, 0x30, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0F, // 8
+  0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0xFE, 0xFC, 0x0C, 0x1C, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, // 9
+  0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, // :
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0x7C, 0x3C, 0x00, 0x00, 0x00, 0x00, // ;
+  0x00, 0x00, 0xC0, 0xE0, 0xF0, 0x38, 0x1C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0E, 0x0C, 0x00, 0x00, // <
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, // =
+  0x00, 0x00, 0x0C, 0x1C, 0x38, 0xF0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0E, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, // >
+  0x0C, 0x0E, 0x07, 0x03, 0x03, 0x83, 0xC3, 0xE7, 0x7E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x01, 0x00, 0x00, 0x00, // ?
+  0xFC, 0xFE, 0x07, 0x03, 0xF3, 0xF3, 0x33, 0x37, 0xFE, 0xFC, 0x0F, 0x1F, 0x38, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, // @
+  0xF0, 0xF8, 0x1C, 0x0E, 0x07, 0x07, 0x0E, 0x1C, 0xF8, 0xF0, 0x3F, 0x3F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3F, 0x3F, // A
+  0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0xFE, 0x3C, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0F, // B
+  0xFC, 0xFE, 0x07, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x0C, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1C, 0x0C, // C
+  0xFF, 0xFF, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1C, 0xF8, 0xF0, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x38, 0x1C, 0x0E, 0x07, 0x03, // D
+  0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x03, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, // E
+  0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x03, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // F
+  0xFC, 0xFE, 0x07, 0x03, 0xC3, 0xC3, 0xC3, 0xC7, 0xCE, 0xCC, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, // G
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, // H
+  0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x30, 0x30, 0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, // I
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0xFF, 0xFF, 0x03, 0x03, 0x0C, 0x1C, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0x00, 0x00, // J
+  0xFF, 0xFF, 0xC0, 0xE0, 0xF0, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x3F, 0x3F, 0x00, 0x01, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0x30, // K
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, // L
+  0xFF, 0xFF, 0x0C, 0x1C, 0xF8, 0xF8, 0x1C, 0x0C, 0xFF, 0xFF, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, // M
+  0xFF, 0xFF, 0x30, 0x70, 0xE0, 0xC0, 0x80, 0x00, 0xFF, 0xFF, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x3F, 0x3F, // N
+  0xFC, 0xFE, 0x07, 0x03, 0x03, 0x03, 0x03, 0x07, 0xFE, 0xFC, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, // O
+  0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // P
+  0xFC, 0xFE, 0x07, 0x03, 0x03, 0x03, 0x03, 0x07, 0xFE, 0xFC, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0xF0, 0xF8, 0xDF, 0xCF, // Q
+  0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C, 0x3F, 0x3F, 0x00, 0x00, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0x30, // R
+  0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0x8E, 0x0C, 0x0C, 0x1C, 0x38, 0x30, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0F, // S
+  0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, // T
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, // U
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0x38, 0x1C, 0x0E, 0x07, 0x03, // V
+  0xFF, 0xFF, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x1F, 0x38, 0x38, 0x1F, 0x1F, 0x38, 0x38, 0x1F, 0x0F, // W
+  0x0F, 0x1F, 0x38, 0xF0, 0xE0, 0xE0, 0xF0, 0x38, 0x1F, 0x0F, 0x3C, 0x3E, 0x07, 0x03, 0x01, 0x01, 0x03, 0x07, 0x3E, 0x3C, // X
+  0x3F, 0x7F, 0xE0, 0xC0, 0x80, 0x80, 0xC0, 0xE0, 0x7F, 0x3F, 0x00, 0x00, 0x00, 0x01, 0x3F, 0x3F, 0x01, 0x00, 0x00, 0x00, // Y
+  0x03, 0x03, 0x03, 0x83, 0xC3, 0xE3, 0x73, 0x3B, 0x1F, 0x0F, 0x3C, 0x3E, 0x37, 0x33, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, // Z
+  0x00, 0x00, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, // [
+  0x0C, 0x1C, 0x38, 0x70, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0E, 0x0C, // backslash
+  0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x3F, 0x3F, 0x00, 0x00, // ]
+  0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x1C, 0x38, 0x70, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ^
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, // _
+  0x00, 0x00, 0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // `
+  0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x70, 0xE0, 0xC0, 0x0C, 0x1E, 0x3F, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x3F, // a
+  0xFF, 0xFF, 0x30, 0x30, 0x30, 0x30, 0x30, 0x70, 0xE0, 0xC0, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, // b
+  0xC0, 0xE0, 0x70, 0x30, 0x30, 0x30, 0x30, 0x70, 0xE0, 0xC0, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1C, 0x0C, // c
+  0xC0, 0xE0, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0xFF, 0xFF, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3F, 0x3F, // d
+  0xC0, 0xE0, 0x70, 0x30, 0x30, 0x30, 0x30, 0x70, 0xE0, 0xC0, 0x0F, 0x1F, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x03, 0x03, // e
+  0xC0, 0xC0, 0xFC, 0xFE, 0xC7, 0xC3, 0x03, 0x07, 0x0E, 0x0C, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // f
+  0xC0, 0xE0, 0x70, 0x30, 0x30, 0x30, 0x30, 0x70, 0xE0, 0xC0, 0x03, 0x07, 0xCE, 0xCC, 0xCC, 0xCC, 0xCC, 0xEC, 0x7F, 0x3F, // g
+  0xFF, 0xFF, 0x30, 0x30, 0x30, 0x30, 0x30, 0x70, 0xE0, 0xC0, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, // h
+  0x00, 0x00, 0x30, 0x30, 0xF3, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x00, 0x00, // i
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0xF3, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xE0, 0x7F, 0x3F, 0x00, 0x00, // j
+  0x03, 0x03, 0xFF, 0xFF, 0x00, 0x80, 0xC0, 0xE0, 0x70, 0x30, 0x30, 0x30, 0x3F, 0x3F, 0x03, 0x07, 0x0F, 0x1C, 0x38, 0x30, // k
+  0x00, 0x00, 0x03, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x00, 0x00, // l
+  0xF0, 0xF0, 0x30, 0x30, 0xF0, 0xF0, 0x30, 0x70, 0xE0, 0xC0, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, // m
+  0xF0, 0xF0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x70, 0xE0, 0xC0, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, // n
+  0xC0, 0xE0, 0x70, 0x30, 0x30, 0x30, 0x30, 0x70, 0xE0, 0xC0, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, // o
+  0xF0, 0xF0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x70, 0xE0, 0xC0, 0xFF, 0xFF, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0E, 0x07, 0x03, // p
+  0xC0, 0xE0, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0xF0, 0xF0, 0x03, 0x07, 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0xFF, 0xFF, // q
+  0xF0, 0xF0, 0xC0, 0xE0, 0x70, 0x30, 0x30, 0x70, 0xE0, 0xC0, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // r
+  0xC0, 0xE0, 0xF0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x01, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x1E, 0x0C, // s
+  0x30, 0x30, 0xFF, 0xFF, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x38, 0x1C, 0x0C, // t
+  0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, // u
+  0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0x38, 0x1C, 0x0E, 0x07, 0x03, // v
+  0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x0F, 0x1F, 0x38, 0x38, 0x1F, 0x1F, 0x38, 0x38, 0x1F, 0x0F, // w
+  0x30, 0x70, 0xE0, 0xC0, 0x80, 0x80, 0xC0, 0xE0, 0x70, 0x30, 0x30, 0x38, 0x1C, 0x0F, 0x07, 0x07, 0x0F, 0x1C, 0x38, 0x30, // x
+  0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x03, 0x07, 0xCE, 0xCC, 0xCC, 0xCC, 0xCC, 0xEC, 0x7F, 0x3F, // y
+  0x30, 0x30, 0x30, 0x30, 0x30, 0xB0, 0xF0, 0xF0, 0x30, 0x30, 0x30, 0x30, 0x3C, 0x3E, 0x37, 0x33, 0x31, 0x30, 0x30, 0x30, // z
+  0xC0, 0xC0, 0xC0, 0xE0, 0xFC, 0x3E, 0x07, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, // {
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, // |
+  0x03, 0x03, 0x03, 0x07, 0x3E, 0xFC, 0xE0, 0xC0, 0xC0, 0xC0, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0x01, 0x00, 0x00, 0x00, // }
+  0xC0, 0xE0, 0x70, 0x70, 0xE0, 0xC0, 0x80, 0x80, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x01, 0x00, // ~
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF  // 0x7F
+};
+
+#endif  // OLED_BIGCHARS == 2
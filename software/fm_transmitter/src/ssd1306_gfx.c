@@ -0,0 +1,172 @@
+// ===================================================================================
+// Graphics Primitives and Blit Kernels for the SSD1306 Page-Strip Renderer   * v1.0 *
+// ===================================================================================
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#include "ssd1306_gfx.h"
+
+// Clipped part of a bitmap within the page buffer. Every buffer byte is made of the
+// source line above (pa) and below (pb) the page border:
+//   v = (pa[i] >> ra) | (pb[i] << lb)
+// A missing source line points to the other one with a shift of 8, which leaves
+// nothing of it in the 8-bit result, so the kernels need no branch per byte.
+const uint8_t* GFX_pa;                            // source line above page border
+const uint8_t* GFX_pb;                            // source line below page border
+uint8_t GFX_ra, GFX_lb;                           // shifts of both source lines
+uint8_t GFX_mask;                                 // pixel lines within page
+uint8_t GFX_w;                                    // columns within screen
+
+// Return mask of the pixel lines y .. y+h-1 within the page, 0 if nothing is in it
+uint8_t GFX_lines(uint8_t y, uint8_t h) {
+  int16_t t = (int16_t)y - STRIP_top;             // first line within page
+  int16_t b = t + h;                              // last line + 1 within page
+  if((b <= 0) || (t >= 8)) return 0;
+  if(t < 0) t = 0;
+  if(b > 8) b = 8;
+  return (0xff << t) & (0xff >> (8 - b));
+}
+
+// Clip rectangle to page and screen, return 0 if nothing is in the page
+uint8_t GFX_clip(uint8_t x, uint8_t y, uint8_t w, uint8_t h) {
+  if(x >= OLED_WIDTH) return 0;
+  GFX_mask = GFX_lines(y, h);
+  GFX_w    = (x + w > OLED_WIDTH) ? OLED_WIDTH - x : w;
+  return GFX_mask;
+}
+
+// Clip bitmap (bmp) to page and screen, set source lines, return 0 if nothing to do
+uint8_t GFX_clipBitmap(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t* bmp) {
+  if(!GFX_clip(x, y, w, h)) return 0;
+  int16_t rel = (int16_t)STRIP_top + 8 - y;       // first bitmap line in page + 8
+  uint8_t dy  = rel & 7;                          // vertical shift
+  uint8_t a   = rel >> 3;                         // source line above + 1
+  const uint8_t* p = bmp;
+  for(uint8_t i=a; i>1; i--) p += w;              // -> p = bmp + (a - 1) * w
+  if(!a) {                                        // bitmap starts within page
+    GFX_pa = p;   GFX_ra = 8;                     // nothing above
+    GFX_pb = p;   GFX_lb = 8 - dy;
+  }
+  else if(!dy || (a == (h + 7) >> 3)) {           // nothing below
+    GFX_pa = p;   GFX_ra = dy;
+    GFX_pb = p;   GFX_lb = 8;
+  }
+  else {
+    GFX_pa = p;   GFX_ra = dy;
+    GFX_pb = p + w; GFX_lb = 8 - dy;
+  }
+  return 1;
+}
+
+// ===================================================================================
+// Blit Kernels
+// ===================================================================================
+
+// Draw bitmap (set pixels only)
+void GFX_blit(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t* bmp) {
+  if(!GFX_clipBitmap(x, y, w, h, bmp)) return;
+  const uint8_t* pa = GFX_pa;
+  const uint8_t* pb = GFX_pb;
+  uint8_t* buf = &STRIP_buf[x];
+  uint8_t ra = GFX_ra, lb = GFX_lb, mask = GFX_mask;
+  for(uint8_t i=GFX_w; i; i--)
+    *buf++ |= ((*pa++ >> ra) | (*pb++ << lb)) & mask;
+}
+
+// Draw bitmap mirrored horizontally (set pixels only)
+void GFX_blitMirror(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t* bmp) {
+  if(!GFX_clipBitmap(x, y, w, h, bmp)) return;
+  const uint8_t* pa = GFX_pa + w;                 // start at last column
+  const uint8_t* pb = GFX_pb + w;
+  uint8_t* buf = &STRIP_buf[x];
+  uint8_t ra = GFX_ra, lb = GFX_lb, mask = GFX_mask;
+  for(uint8_t i=GFX_w; i; i--)
+    *buf++ |= ((*--pa >> ra) | (*--pb << lb)) & mask;
+}
+
+// Overwrite rectangle with inverted bitmap
+void GFX_blitInvert(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t* bmp) {
+  if(!GFX_clipBitmap(x, y, w, h, bmp)) return;
+  const uint8_t* pa = GFX_pa;
+  const uint8_t* pb = GFX_pb;
+  uint8_t* buf = &STRIP_buf[x];
+  uint8_t ra = GFX_ra, lb = GFX_lb, mask = GFX_mask;
+  for(uint8_t i=GFX_w; i; i--, buf++)
+    *buf = (*buf | mask) & ~(((*pa++ >> ra) | (*pb++ << lb)) & mask);
+}
+
+// Overwrite the pixels set in mask bitmap (msk) with the pixels of bitmap (bmp),
+// both with the same size and layout
+void GFX_blitMasked(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t* bmp,
+                    const uint8_t* msk) {
+  if(!GFX_clipBitmap(x, y, w, h, bmp)) return;
+  const uint8_t* pa = GFX_pa;
+  const uint8_t* pb = GFX_pb;
+  const uint8_t* ma = msk + (GFX_pa - bmp);       // same lines of mask bitmap
+  const uint8_t* mb = msk + (GFX_pb - bmp);
+  uint8_t* buf = &STRIP_buf[x];
+  uint8_t ra = GFX_ra, lb = GFX_lb, mask = GFX_mask;
+  uint8_t m;
+  for(uint8_t i=GFX_w; i; i--, buf++) {
+    m    = ((*ma++ >> ra) | (*mb++ << lb)) & mask;
+    *buf = (*buf & ~m) | (((*pa++ >> ra) | (*pb++ << lb)) & m);
+  }
+}
+
+// ===================================================================================
+// Primitives
+// ===================================================================================
+
+// Set all pixels of rectangle
+void GFX_fill(uint8_t x, uint8_t y, uint8_t w, uint8_t h) {
+  if(!GFX_clip(x, y, w, h)) return;
+  uint8_t* buf = &STRIP_buf[x];
+  for(uint8_t i=GFX_w; i; i--) *buf++ |= GFX_mask;
+}
+
+// Clear all pixels of rectangle
+void GFX_clear(uint8_t x, uint8_t y, uint8_t w, uint8_t h) {
+  if(!GFX_clip(x, y, w, h)) return;
+  uint8_t* buf = &STRIP_buf[x];
+  for(uint8_t i=GFX_w; i; i--) *buf++ &= ~GFX_mask;
+}
+
+// Invert all pixels of rectangle
+void GFX_invert(uint8_t x, uint8_t y, uint8_t w, uint8_t h) {
+  if(!GFX_clip(x, y, w, h)) return;
+  uint8_t* buf = &STRIP_buf[x];
+  for(uint8_t i=GFX_w; i; i--) *buf++ ^= GFX_mask;
+}
+
+// Draw line from (x0,y0) to (x1,y1), only the points within the page are plotted
+void GFX_line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
+  int16_t dx  =  (x1 > x0) ? x1 - x0 : x0 - x1;
+  int16_t dy  = -((y1 > y0) ? y1 - y0 : y0 - y1);
+  int8_t  sx  = (x0 < x1) ? 1 : -1;
+  int8_t  sy  = (y0 < y1) ? 1 : -1;
+  int16_t err = dx + dy, e2;
+  uint8_t top = (y0 < y1) ? y0 : y1;
+  if(!GFX_lines(top, 1 - dy)) return;             // line not in page
+  while(1) {
+    if((x0 < OLED_WIDTH) && ((uint8_t)(y0 - STRIP_top) < 8))
+      STRIP_buf[x0] |= 1 << (y0 - STRIP_top);
+    if((x0 == x1) && (y0 == y1)) break;
+    e2 = err << 1;
+    if(e2 >= dy) { err += dy; x0 += sx; }
+    if(e2 <= dx) { err += dx; y0 += sy; }
+  }
+}
+
+// Draw rectangle outline
+void GFX_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h) {
+  GFX_hline(x, y, w);
+  GFX_hline(x, y + h - 1, w);
+  GFX_vline(x, y, h);
+  GFX_vline(x + w - 1, y, h);
+}
+
+// Draw bar graph: outline with a bar of (len) pixels inside, one pixel gap
+void GFX_bar(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t len) {
+  if(len > w - 4) len = w - 4;
+  GFX_rect(x, y, w, h);
+  GFX_fill(x + 2, y + 2, len, h - 4);
+}
@@ -0,0 +1,79 @@
+// ===================================================================================
+// Graphics Primitives and Blit Kernels for the SSD1306 Page-Strip Renderer   * v1.0 *
+// ===================================================================================
+//
+// Drawing functions for the page buffer of the strip renderer (see ssd1306_strip.h).
+// They are called for every page while STRIP_render() composes the screen (object
+// STRIP_CALL) and only touch the pixel lines STRIP_top .. STRIP_top+7 held by the
+// buffer, so each function can be called with the coordinates of the whole screen.
+// Everything is clipped at the right and bottom border of the screen and bitmaps can
+// be placed at any pixel line.
+//
+// Blit kernels (bitmap layout as for OLED_drawBitmap(): w bytes per 8-pixel line):
+// --------------------------------------------------------------------------------
+// GFX_blit(x,y,w,h,bmp)            Draw bitmap (set pixels only)          ~14 cycles
+// GFX_blitMirror(x,y,w,h,bmp)      Draw bitmap mirrored horizontally      ~14 cycles
+// GFX_blitInvert(x,y,w,h,bmp)      Overwrite rectangle with inverted bmp  ~16 cycles
+// GFX_blitMasked(x,y,w,h,bmp,msk)  Overwrite pixels set in mask bitmap    ~24 cycles
+//                                  (msk) with the pixels of bitmap (bmp)
+//
+// Primitives:
+// -----------
+// GFX_fill(x,y,w,h)                Set all pixels of rectangle             ~6 cycles
+// GFX_clear(x,y,w,h)               Clear all pixels of rectangle           ~6 cycles
+// GFX_invert(x,y,w,h)              Invert all pixels of rectangle          ~6 cycles
+// GFX_pixel(x,y)                   Set pixel
+// GFX_hline(x,y,w)                 Draw horizontal line
+// GFX_vline(x,y,h)                 Draw vertical line
+// GFX_line(x0,y0,x1,y1)            Draw line (Bresenham)
+// GFX_rect(x,y,w,h)                Draw rectangle outline
+// GFX_bar(x,y,w,h,len)             Draw bar graph: outline with a bar of (len) pixels
+//                                  inside, one pixel gap (len 0 .. w-4)
+//
+// Cycle numbers are per buffer byte (one column of one page) in the inner loop,
+// counted from the RV32EC instructions with the bitmap in flash (one wait state).
+// Setup and clipping add roughly 60 cycles per call and page. For comparison, the
+// I2C transfer of one byte at 400 kHz takes 180 cycles at 8 MHz.
+//
+// Example: gain bar and battery icon
+// ----------------------------------
+// GFX_bar(0, 24, 64, 8, gain);                  // gain bar, gain 0..60
+// GFX_bar(100, 25, 14, 7, level);               // battery body, level 0..10
+// GFX_fill(114, 27, 1, 3);                      // battery pole
+//
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "ssd1306_strip.h"
+
+// Blit Kernels
+void GFX_blit(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t* bmp);
+void GFX_blitMirror(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t* bmp);
+void GFX_blitInvert(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t* bmp);
+void GFX_blitMasked(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t* bmp,
+                    const uint8_t* msk);
+
+// Primitives
+void GFX_fill(uint8_t x, uint8_t y, uint8_t w, uint8_t h);
+void GFX_clear(uint8_t x, uint8_t y, uint8_t w, uint8_t h);
+void GFX_invert(uint8_t x, uint8_t y, uint8_t w, uint8_t h);
+void GFX_line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+void GFX_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h);
+void GFX_bar(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t len);
+
+// Mask of the pixel lines y .. y+h-1 within the page (0: none)
+uint8_t GFX_lines(uint8_t y, uint8_t h);
+
+#define GFX_pixel(x,y)      GFX_fill(x, y, 1, 1)
+#define GFX_hline(x,y,w)    GFX_fill(x, y, w, 1)
+#define GFX_vline(x,y,h)    GFX_fill(x, y, 1, h)
+
+#ifdef __cplusplus
+};
+#endif
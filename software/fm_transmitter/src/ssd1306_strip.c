@@ -0,0 +1,62 @@
+// ===================================================================================
+// SSD1306 Page-Strip Renderer                                                * v1.0 *
+// ===================================================================================
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#include "ssd1306_strip.h"
+#include "ssd1306_gfx.h"
+
+extern const uint8_t OLED_FONT[];                 // 5x8 font (ssd1306_txt.c)
+
+uint8_t STRIP_buf[OLED_WIDTH];                    // page buffer
+uint8_t STRIP_top;                                // first pixel line of page
+
+// Draw string (str) in 5x8 font at pixel position (x,y) into page buffer
+void STRIP_text(uint8_t x, uint8_t y, const char* str) {
+  uint8_t mask = GFX_lines(y, 8);
+  int8_t  sh   = (int8_t)y - STRIP_top;           // shift of the characters
+  uint8_t i, v;
+  if(!mask) return;                               // nothing in this page
+  while(*str && (x <= OLED_WIDTH - 6)) {
+    uint16_t ptr = *str++ - 32;                   // character pointer
+    ptr += ptr << 2;                              // -> ptr = (ch - 32) * 5;
+    x++;                                          // space between characters
+    for(i=5; i; i--, x++) {
+      v = OLED_FONT[ptr++];
+      v = (sh < 0) ? v >> -sh : v << sh;
+      STRIP_buf[x] |= v & mask;
+    }
+  }
+}
+
+// Draw part of object (obj) within the page
+void STRIP_draw(const STRIP_OBJ* obj) {
+  uint8_t x = obj->x, y = obj->y, w = obj->w, h = obj->h;
+  switch(obj->type) {
+    case STRIP_BMP: GFX_blit(x, y, w, h, (const uint8_t*)obj->data); break;
+    case STRIP_TXT: STRIP_text(x, y, (const char*)obj->data);       break;
+    case STRIP_SET: GFX_fill(x, y, w, h);                           break;
+    case STRIP_CLR: GFX_clear(x, y, w, h);                          break;
+    case STRIP_INV: GFX_invert(x, y, w, h);                         break;
+    case STRIP_FNC: ((void (*)(void))obj->data)();                  break;
+    default:        break;
+  }
+}
+
+// Render list (*list) of (n) objects to the whole screen
+void STRIP_render(const STRIP_OBJ* list, uint8_t n) {
+  uint8_t i;
+  #if OLED_CACHE > 0
+  OLED_cacheClear(0, OLED_WIDTH);                 // screen is overwritten
+  #endif
+  OLED_window(OLED_XOFF, OLED_XOFF + OLED_WIDTH - 1, 0, OLED_HEIGHT / 8 - 1);
+  for(STRIP_top=0; STRIP_top<OLED_HEIGHT; STRIP_top+=8) {
+    for(i=0; i<OLED_WIDTH; i++) STRIP_buf[i] = 0; // clear page buffer
+    for(i=0; i<n; i++) STRIP_draw(&list[i]);      // draw objects
+    if(OLED_DEV_SH1106) OLED_cursor(0, STRIP_top >> 3); // no horizontal addressing
+    OLED_start();                                 // start transmission to OLED
+    OLED_ctrl(OLED_DAT_MODE);                     // set data mode
+    for(i=0; i<OLED_WIDTH; i++) OLED_send(STRIP_buf[i]); // send page
+    OLED_end();                                   // stop transmission
+  }
+}
@@ -0,0 +1,67 @@
+// ===================================================================================
+// SSD1306 Page-Strip Renderer                                                * v1.0 *
+// ===================================================================================
+//
+// Framebuffer-style composition with a buffer of one page (OLED_WIDTH x 8 pixels)
+// instead of the whole screen. The screen is described by a list of objects that
+// are drawn in list order, so later objects overlap earlier ones. For every page
+// the renderer clears the buffer, draws the part of each object that falls into
+// the page and sends the page to the OLED, then moves on to the next page.
+//
+// Functions available:
+// --------------------
+// STRIP_render(list,n)     Render list (*list) of (n) objects to the whole screen
+//
+// Objects (x, y, w, h in pixels, y and h need not be multiples of 8):
+// -------------------------------------------------------------------
+// STRIP_BITMAP(x,y,w,h,bmp)  Bitmap (OR), same layout as OLED_drawBitmap(): w bytes
+//                            for every 8-pixel line, (h + 7) / 8 lines
+// STRIP_TEXT(x,y,str)        String in 5x8 font (OR), 6 pixels per character
+// STRIP_FILL(x,y,w,h)        Set all pixels of rectangle
+// STRIP_CLEAR(x,y,w,h)       Clear all pixels of rectangle
+// STRIP_INVERT(x,y,w,h)      Invert all pixels of rectangle (e.g. for selections)
+// STRIP_CALL(func)           Call function void func(void) that draws with the
+//                            functions of ssd1306_gfx.h (e.g. bar graphs, lines)
+//
+// RAM use is the page buffer (OLED_WIDTH bytes), the list can be in flash. A frame
+// is sent as one window command and one data transaction per page.
+//
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "ssd1306_txt.h"
+
+// Object types
+enum { STRIP_BMP, STRIP_TXT, STRIP_SET, STRIP_CLR, STRIP_INV, STRIP_FNC };
+
+// Object
+typedef struct {
+  uint8_t     type;           // object type (see above)
+  uint8_t     x, y;           // position in pixels
+  uint8_t     w, h;           // size in pixels (text: ignored)
+  const void* data;           // bitmap, string or function (or NULL)
+} STRIP_OBJ;
+
+#define STRIP_BITMAP(x,y,w,h,bmp) { STRIP_BMP, x, y, w, h, bmp }
+#define STRIP_TEXT(x,y,str)       { STRIP_TXT, x, y, 0, 8, str }
+#define STRIP_FILL(x,y,w,h)       { STRIP_SET, x, y, w, h, 0 }
+#define STRIP_CLEAR(x,y,w,h)      { STRIP_CLR, x, y, w, h, 0 }
+#define STRIP_INVERT(x,y,w,h)     { STRIP_INV, x, y, w, h, 0 }
+#define STRIP_CALL(func)          { STRIP_FNC, 0, 0, 0, 0, (const void*)func }
+
+// Renderer Functions
+void STRIP_render(const STRIP_OBJ* list, uint8_t n);  // render list to whole screen
+
+// Page buffer with the pixel lines STRIP_top .. STRIP_top+7
+extern uint8_t STRIP_buf[OLED_WIDTH];
+extern uint8_t STRIP_top;
+
+#ifdef __cplusplus
+};
+#endif
@@ -17,6 +17,7 @@
 // 2022 by Stefan Wagner:   https://github.com/wagiminator
 
 #include "ssd1306_txt.h"
+#include "arith.h"
 
 // ===================================================================================
 // Standard ASCII 5x8 Font (chars 32 - 127)
@@ -60,6 +61,35 @@ const uint8_t OLED_FONT[] = {
 // 13x32 7-Segment Font (0 - 9)
 // ===================================================================================
 #if OLED_SEG_FONT == 1
+#if OLED_SEG_RLE > 0
+// Run-length encoded with tools/bitmap_rle.py (--split 52), one bitmap per digit
+const uint8_t OLED_FONT_SEG_RLE[] = {
+  0x02, 0xFC, 0xF9, 0xF3, 0x84, 0x07, 0x05, 0xF3, 0xF9, 0xFC, 0x7F, 0x3F, 0x1F, 0x84, 0x00, 0x05,
+  0x1F, 0x3F, 0x7F, 0xFF, 0xFE, 0xFC, 0x84, 0x00, 0x05, 0xFC, 0xFE, 0xFF, 0x1F, 0x4F, 0x67, 0x84,
+  0x70, 0x02, 0x67, 0x4F, 0x1F, 0x87, 0x00, 0x02, 0xF0, 0xF8, 0xFC, 0x87, 0x00, 0x02, 0x1F, 0x3F,
+  0x7F, 0x87, 0x00, 0x02, 0xFC, 0xFE, 0xFF, 0x87, 0x00, 0x02, 0x07, 0x0F, 0x1F, 0x02, 0x00, 0x01,
+  0x03, 0x84, 0x07, 0x05, 0xF3, 0xF9, 0xFC, 0x00, 0x00, 0x80, 0x84, 0xC0, 0x05, 0x9F, 0x3F, 0x7F,
+  0xFF, 0xFE, 0xFC, 0x84, 0x01, 0x80, 0x00, 0x02, 0x1F, 0x4F, 0x67, 0x84, 0x70, 0x02, 0x60, 0x40,
+  0x00, 0x02, 0x00, 0x01, 0x03, 0x84, 0x07, 0x05, 0xF3, 0xF9, 0xFC, 0x00, 0x00, 0x80, 0x84, 0xC0,
+  0x02, 0x9F, 0x3F, 0x7F, 0x80, 0x00, 0x84, 0x01, 0x05, 0xFC, 0xFE, 0xFF, 0x00, 0x40, 0x60, 0x84,
+  0x70, 0x02, 0x67, 0x4F, 0x1F, 0x02, 0xFC, 0xF8, 0xF0, 0x84, 0x00, 0x05, 0xF0, 0xF8, 0xFC, 0x7F,
+  0x3F, 0x9F, 0x84, 0xC0, 0x02, 0x9F, 0x3F, 0x7F, 0x80, 0x00, 0x84, 0x01, 0x02, 0xFC, 0xFE, 0xFF,
+  0x87, 0x00, 0x02, 0x07, 0x0F, 0x1F, 0x02, 0xFC, 0xF9, 0xF3, 0x84, 0x07, 0x05, 0x03, 0x01, 0x00,
+  0x7F, 0x3F, 0x9F, 0x84, 0xC0, 0x00, 0x80, 0x82, 0x00, 0x84, 0x01, 0x05, 0xFC, 0xFE, 0xFF, 0x00,
+  0x40, 0x60, 0x84, 0x70, 0x02, 0x67, 0x4F, 0x1F, 0x02, 0xFC, 0xF9, 0xF3, 0x84, 0x07, 0x05, 0x03,
+  0x01, 0x00, 0x7F, 0x3F, 0x9F, 0x84, 0xC0, 0x05, 0x80, 0x00, 0x00, 0xFF, 0xFE, 0xFC, 0x84, 0x01,
+  0x05, 0xFC, 0xFE, 0xFF, 0x1F, 0x4F, 0x67, 0x84, 0x70, 0x02, 0x67, 0x4F, 0x1F, 0x02, 0xFC, 0xF9,
+  0xF3, 0x84, 0x07, 0x05, 0xF3, 0xF9, 0xFC, 0x7F, 0x3F, 0x1F, 0x84, 0x00, 0x02, 0x1F, 0x3F, 0x7F,
+  0x87, 0x00, 0x02, 0xFC, 0xFE, 0xFF, 0x87, 0x00, 0x02, 0x07, 0x0F, 0x1F, 0x02, 0xFC, 0xF9, 0xF3,
+  0x84, 0x07, 0x05, 0xF3, 0xF9, 0xFC, 0x7F, 0x3F, 0x9F, 0x84, 0xC0, 0x05, 0x9F, 0x3F, 0x7F, 0xFF,
+  0xFE, 0xFC, 0x84, 0x01, 0x05, 0xFC, 0xFE, 0xFF, 0x1F, 0x4F, 0x67, 0x84, 0x70, 0x02, 0x67, 0x4F,
+  0x1F, 0x02, 0xFC, 0xF9, 0xF3, 0x84, 0x07, 0x05, 0xF3, 0xF9, 0xFC, 0x7F, 0x3F, 0x9F, 0x84, 0xC0,
+  0x02, 0x9F, 0x3F, 0x7F, 0x80, 0x00, 0x84, 0x01, 0x05, 0xFC, 0xFE, 0xFF, 0x00, 0x40, 0x60, 0x84,
+  0x70, 0x02, 0x67, 0x4F, 0x1F
+};
+
+const uint16_t OLED_FONT_SEG_RLE_IDX[] = { 0, 37, 61, 97, 133, 166, 200, 237, 268, 305 };
+#else
 const uint8_t OLED_FONT_SEG[] = {
   0xFC, 0xF9, 0xF3, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF3, 0xF9, 0xFC, // 0
   0x7F, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x7F, 
@@ -102,6 +132,7 @@ const uint8_t OLED_FONT_SEG[] = {
   0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFC, 0xFE, 0xFF, 
   0x00, 0x40, 0x60, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x67, 0x4F, 0x1F
 };
+#endif
 
 const uint8_t OLED_FONT_POINT[] = {
   0x00, 0x00, 0x00,
@@ -135,15 +166,63 @@ const uint8_t OLED_FONT_POINT[] = {
 #endif
 
 // ===================================================================================
-// OLED Control Functions
+// OLED Transport (DMA)
 // ===================================================================================
+#if OLED_TRANSPORT > 0
+
+// Double buffer: one half is filled while the other one is sent via DMA
+uint8_t  OLED_txBuf[2][OLED_TX_BUF];
+uint8_t* OLED_txBase = OLED_txBuf[0];             // start of half being filled
+uint8_t* OLED_txPtr  = OLED_txBuf[0];             // next free byte
+uint8_t* OLED_txLim  = OLED_txBuf[0] + OLED_TX_BUF; // end of half being filled
+
+// Send filled part of the buffer via DMA, continue with the other half
+void OLED_txFlush(void) {
+  if(OLED_txPtr == OLED_txBase) return;           // nothing to send
+  #if OLED_TRANSPORT == 1
+  I2C_writeDMA(OLED_txBase, OLED_txPtr - OLED_txBase); // waits for the other half
+  #else
+  SPI_writeDMA(OLED_txBase, OLED_txPtr - OLED_txBase);
+  #endif
+  OLED_txBase = (OLED_txBase == OLED_txBuf[0]) ? OLED_txBuf[1] : OLED_txBuf[0];
+  OLED_txPtr  = OLED_txBase;
+  OLED_txLim  = OLED_txBase + OLED_TX_BUF;
+}
 
-// Screen offsets
-#if OLED_SH1106 == 1
-  #define OLED_XOFF ((128 - OLED_WIDTH) / 2) + 2
-#else
-  #define OLED_XOFF ((128 - OLED_WIDTH) / 2)
-#endif
+// Start transmission
+void OLED_start(void) {
+  #if OLED_TRANSPORT == 1
+  I2C_start(OLED_DEV_ADDR << 1);                  // waits for running transfer
+  #else
+  SPI_start();
+  #endif
+}
+
+// Control byte: I2C sends it, SPI sets the D/C pin (after the bytes before)
+void OLED_ctrl(uint8_t c) {
+  #if OLED_TRANSPORT == 1
+  OLED_send(c);
+  #else
+  OLED_txFlush();
+  SPI_wait();
+  PIN_write(OLED_SPI_DC, c & OLED_DAT_MODE);
+  #endif
+}
+
+// Stop transmission (I2C: after the last buffer has been sent)
+void OLED_end(void) {
+  OLED_txFlush();
+  #if OLED_TRANSPORT == 1
+  I2C_stopDMA();
+  #else
+  SPI_stop();
+  #endif
+}
+#endif  // OLED_TRANSPORT > 0
+
+// ===================================================================================
+// OLED Control Functions
+// ===================================================================================
 
 // OLED initialisation sequence
 const uint8_t OLED_INIT_CMD[] = {
@@ -164,63 +243,175 @@ const uint8_t OLED_INIT_CMD[] = {
   #if OLED_INVERT > 0
   OLED_INVERT_ON,                                 // invert screen
   #endif
+  #if OLED_INIT_ON > 0
   OLED_DISPLAY_ON                                 // display on
+  #endif
 };
 
-// OLED init function
-void OLED_init(void) {
-  #if OLED_INIT_I2C > 0
+#if OLED_AUTODETECT > 0
+uint8_t OLED_addr   = OLED_ADDR;                  // detected I2C address
+uint8_t OLED_sh1106 = OLED_SH1106;                // detected controller (1: SH1106)
+
+// Detect I2C address (OLED_ADDR or OLED_ADDR_ALT) and, if OLED_AUTODETECT is 1, the
+// controller, return 0 if no device answers (address and controller are kept then).
+// The SSD1306 datasheet leaves bits 5..0 of the status byte undocumented, but the
+// SSD1306 returns an ID there (bits 2..0: 6 or 3, 7 on some clones). The SH1106
+// datasheet only defines the flag bits above (BUSY, ON/OFF) and reads zeros in bits
+// 2..0. This is a heuristic; for controllers that break it use OLED_AUTODETECT 2.
+uint8_t OLED_detect(void) {
+  if(I2C_probe(OLED_ADDR))          OLED_addr = OLED_ADDR;
+  else if(I2C_probe(OLED_ADDR_ALT)) OLED_addr = OLED_ADDR_ALT;
+  else return 0;                                  // no OLED found
+  #if OLED_AUTODETECT == 1
+  OLED_sh1106 = !(I2C_read(OLED_addr) & 0x07);    // SH1106: no ID in status byte
+  #endif
+  return 1;
+}
+#endif
+
+// OLED init function, returns 0 if autodetection found no OLED
+uint8_t OLED_init(void) {
+  uint8_t i;
+  #if OLED_TRANSPORT == 2
+  SPI_init();                                     // initialize SPI and pins
+  PIN_output(OLED_SPI_DC);
+  PIN_low(OLED_SPI_RES);                          // reset OLED
+  PIN_output(OLED_SPI_RES);
+  DLY_ms(1);
+  PIN_high(OLED_SPI_RES);
+  #elif OLED_INIT_I2C > 0
   I2C_init();                                     // initialize I2C first
   #endif
   #if OLED_BOOT_TIME > 0
   DLY_ms(OLED_BOOT_TIME);                         // time for the OLED to boot up
   #endif
-  I2C_start(OLED_ADDR << 1);                      // start transmission to OLED
-  I2C_write(OLED_CMD_MODE);                       // set command mode
-  I2C_writeBuffer((uint8_t*)OLED_INIT_CMD, sizeof(OLED_INIT_CMD)); // send the command bytes
+  #if OLED_AUTODETECT > 0
+  if(!OLED_detect()) return 0;                    // find address and controller
+  #endif
+  OLED_start();                                   // start transmission to OLED
+  OLED_ctrl(OLED_CMD_MODE);                       // set command mode
+  for(i=0; i<sizeof(OLED_INIT_CMD); i++) OLED_send(OLED_INIT_CMD[i]); // send command bytes
+  OLED_end();                                     // stop transmission
+  return 1;
 }
 
 // Switch display on/off (0: display off, 1: display on)
 void OLED_display(uint8_t val) {
-  I2C_start(OLED_ADDR << 1);                      // start transmission to OLED
-  I2C_write(OLED_CMD_MODE);                       // set command mode
-  I2C_write(val ? OLED_DISPLAY_ON : OLED_DISPLAY_OFF); // set display power
-  I2C_stop();                                     // stop transmission
+  OLED_start();                                   // start transmission to OLED
+  OLED_ctrl(OLED_CMD_MODE);                       // set command mode
+  OLED_send(val ? OLED_DISPLAY_ON : OLED_DISPLAY_OFF); // set display power
+  OLED_end();                                     // stop transmission
 }
 
 // Set display contrast (0-255)
 void OLED_contrast(uint8_t val) {
-  I2C_start(OLED_ADDR << 1);                      // start transmission to OLED
-  I2C_write(OLED_CMD_MODE);                       // set command mode
-  I2C_write(OLED_CONTRAST);                       // contrast command
-  I2C_write(val);                                 // set contrast value
-  I2C_stop();                                     // stop transmission
+  OLED_start();                                   // start transmission to OLED
+  OLED_ctrl(OLED_CMD_MODE);                       // set command mode
+  OLED_send(OLED_CONTRAST);                       // contrast command
+  OLED_send(val);                                 // set contrast value
+  OLED_end();                                     // stop transmission
 }
 
 // Invert display (0: inverse off, 1: inverse on)
 void OLED_invert(uint8_t val) {
-  I2C_start(OLED_ADDR << 1);                      // start transmission to OLED
-  I2C_write(OLED_CMD_MODE);                       // set command mode
-  I2C_write(val ? OLED_INVERT_ON : OLED_INVERT_OFF); // set invert mode
-  I2C_stop();                                     // stop transmission
+  OLED_start();                                   // start transmission to OLED
+  OLED_ctrl(OLED_CMD_MODE);                       // set command mode
+  OLED_send(val ? OLED_INVERT_ON : OLED_INVERT_OFF); // set invert mode
+  OLED_end();                                     // stop transmission
 }
 
 // Flip display (0: flip off, 1: flip on)
 void OLED_flip(uint8_t xflip, uint8_t yflip) {
-  I2C_start(OLED_ADDR << 1);                      // start transmission to OLED
-  I2C_write(OLED_CMD_MODE);                       // set command mode
-  I2C_write(xflip ? OLED_XFLIP_ON : OLED_XFLIP_OFF); // set x-flip
-  I2C_write(yflip ? OLED_YFLIP_ON : OLED_YFLIP_OFF); // set y-flip
-  I2C_stop();                                     // stop transmission
+  OLED_start();                                   // start transmission to OLED
+  OLED_ctrl(OLED_CMD_MODE);                       // set command mode
+  OLED_send(xflip ? OLED_XFLIP_ON : OLED_XFLIP_OFF); // set x-flip
+  OLED_send(yflip ? OLED_YFLIP_ON : OLED_YFLIP_OFF); // set y-flip
+  OLED_end();                                     // stop transmission
 }
 
 // Scroll display vertically
 void OLED_vscroll(uint8_t y) {
-  I2C_start(OLED_ADDR << 1);                      // start transmission to OLED
-  I2C_write(OLED_CMD_MODE);                       // set command mode
-  I2C_write(OLED_OFFSET);                         // offset command
-  I2C_write(y);                                   // set y-scroll
-  I2C_stop();                                     // stop transmission
+  OLED_start();                                   // start transmission to OLED
+  OLED_ctrl(OLED_CMD_MODE);                       // set command mode
+  OLED_send(OLED_OFFSET);                         // offset command
+  OLED_send(y);                                   // set y-scroll
+  OLED_end();                                     // stop transmission
+}
+
+// Set window for horizontal addressing (RAM columns x0..x1, pages y0..y1)
+void OLED_window(uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1) {
+  if(OLED_DEV_SH1106) return;                     // SH1106: page addressing only
+  OLED_start();                                   // start transmission to OLED
+  OLED_ctrl(OLED_CMD_MODE);                       // set command mode
+  OLED_send(OLED_COLUMNS);                        // set start and end column
+  OLED_send(x0);
+  OLED_send(x1);
+  OLED_send(OLED_PAGES);                          // set start and end page
+  OLED_send(y0);
+  OLED_send(y1);
+  OLED_end();                                     // stop transmission
+}
+
+// Set RAM line shown at the top of the screen (0-63). The image moves without being
+// sent again, RAM lines below OLED_HEIGHT come into view at the edge.
+void OLED_startline(uint8_t y) {
+  OLED_start();                                   // start transmission to OLED
+  OLED_ctrl(OLED_CMD_MODE);                       // set command mode
+  OLED_send(OLED_STARTLINE | (y & 0x3f));         // set start line
+  OLED_end();                                     // stop transmission
+}
+
+// Clear RAM lines below OLED_HEIGHT, which cannot be reached with OLED_cursor()
+void OLED_clearHidden(void) {
+  uint16_t i;
+  if(OLED_DEV_SH1106) {                           // page addressing, 132 columns
+    for(uint8_t y=OLED_HEIGHT / 8; y<8; y++) {
+      OLED_start();                               // start transmission to OLED
+      OLED_ctrl(OLED_CMD_MODE);                   // set command mode
+      OLED_send(OLED_PAGE + y);                   // set page
+      OLED_send(OLED_COLUMN_LOW);                 // set column 0
+      OLED_send(OLED_COLUMN_HIGH);
+      OLED_end();                                 // stop transmission
+      OLED_start();                               // start transmission to OLED
+      OLED_ctrl(OLED_DAT_MODE);                   // set data mode
+      for(i=132; i; i--) OLED_send(0x00);         // clear page
+      OLED_end();                                 // stop transmission
+    }
+    return;
+  }
+  OLED_window(0, 127, OLED_HEIGHT / 8, 7);        // all columns, hidden pages
+  OLED_start();                                   // start transmission to OLED
+  OLED_ctrl(OLED_DAT_MODE);                       // set data mode
+  for(i=(8 - OLED_HEIGHT / 8) << 7; i; i--) OLED_send(0x00);
+  OLED_end();                                     // stop transmission
+  OLED_window(OLED_XOFF, OLED_XOFF + OLED_WIDTH - 1, 0, OLED_HEIGHT / 8 - 1); // full screen
+}
+
+// Scroll line y continuously (speed: OLED_SCROLL_x, left 0: right, 1: left)
+void OLED_marquee(uint8_t y, uint8_t speed, uint8_t left) {
+  #if OLED_CACHE > 0
+  OLED_cacheClear(0, OLED_WIDTH);                 // full-height cells are moving
+  #endif
+  OLED_start();                                   // start transmission to OLED
+  OLED_ctrl(OLED_CMD_MODE);                       // set command mode
+  OLED_send(OLED_SCROLL_OFF);                     // stop running scroll first
+  OLED_send(left ? OLED_SCROLL_LEFT : OLED_SCROLL_RIGHT); // set up scroll
+  OLED_send(0x00);                                // dummy byte
+  OLED_send(y);                                   // start page
+  OLED_send(speed);                               // frames per step
+  OLED_send(y);                                   // end page
+  OLED_send(0x00);                                // dummy bytes
+  OLED_send(0xFF);
+  OLED_send(OLED_SCROLL_ON);                      // activate scroll
+  OLED_end();                                     // stop transmission
+}
+
+// Stop scrolling, the scrolled line must be redrawn afterwards
+void OLED_marqueeStop(void) {
+  OLED_start();                                   // start transmission to OLED
+  OLED_ctrl(OLED_CMD_MODE);                       // set command mode
+  OLED_send(OLED_SCROLL_OFF);                     // deactivate scroll
+  OLED_end();                                     // stop transmission
 }
 
 // ===================================================================================
@@ -233,11 +424,14 @@ uint8_t OLED_x, OLED_y, OLED_i;
 // OLED clear line
 void OLED_clearLine(uint8_t y) {
   uint8_t i;
+  #if OLED_CACHE > 0
+  OLED_cacheClear(0, OLED_WIDTH);                 // full-height cells are changed
+  #endif
   OLED_cursor(0, y);                              // set cursor to line start
-  I2C_start(OLED_ADDR << 1);                      // start transmission to OLED
-  I2C_write(OLED_DAT_MODE);                       // set data mode
-  for(i=OLED_WIDTH; i; i--) I2C_write(0x00);      // clear line
-  I2C_stop();                                     // stop transmission
+  OLED_start();                                   // start transmission to OLED
+  OLED_ctrl(OLED_DAT_MODE);                       // set data mode
+  for(i=OLED_WIDTH; i; i--) OLED_send(0x00);      // clear line
+  OLED_end();                                     // stop transmission
   OLED_cursor(0, y);                              // re-set cursor to line start
 }
 
@@ -251,13 +445,13 @@ void OLED_clear(void) {
 void OLED_cursor(uint8_t x, uint8_t y) {
   if(y >= OLED_HEIGHT / 8) y = 0;                 // limit y
   OLED_x = x; OLED_y = y;                         // set cursor variables
-  x += OLED_XOFF;                                 // add offset
-  I2C_start(OLED_ADDR << 1);                      // start transmission to OLED
-  I2C_write(OLED_CMD_MODE);                       // set command mode
-  I2C_write(OLED_PAGE + y);                       // set line
-  I2C_write(x & 0xf);                             // set column
-  I2C_write((x >> 4) | 0x10);
-  I2C_stop();                                     // stop transmission
+  x += OLED_DEV_XOFF;                             // add offset
+  OLED_start();                                   // start transmission to OLED
+  OLED_ctrl(OLED_CMD_MODE);                       // set command mode
+  OLED_send(OLED_PAGE + y);                       // set line
+  OLED_send(x & 0xf);                             // set column
+  OLED_send((x >> 4) | 0x10);
+  OLED_end();                                     // stop transmission
 }
 
 // OLED set text invert
@@ -267,17 +461,27 @@ void OLED_textinvert(uint8_t yes) {
 
 #if OLED_BIGCHARS > 0
 
+uint8_t OLED_sz;
+
+#if OLED_BIGCHARS == 1
 // Character buffer
 uint8_t OLED_buf[2*10];
-uint8_t OLED_sz;
+
+// Stretched nibbles: abcd -> aabbccdd
+const uint8_t OLED_STRETCH[] = {
+  0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F,
+  0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF
+};
 
 // Converts bit pattern abcdefgh into aabbccddeeffgghh
-uint16_t OLED_stretch(uint16_t x) {
-  x = (x & 0xF0)<<4 | (x & 0x0F);
-  x = (x<<2 | x) & 0x3333;
-  x = (x<<1 | x) & 0x5555;
-  return x | x<<1;
+uint16_t OLED_stretch(uint8_t x) {
+  return ((uint16_t)OLED_STRETCH[x >> 4] << 8) | OLED_STRETCH[x & 0x0F];
 }
+#else
+// Precomputed big fonts (ssd1306_bigfont.c, generated by tools/bigfont.py)
+extern const uint8_t OLED_FONT_5X16[];
+extern const uint8_t OLED_FONT_10X16[];
+#endif
 
 // Set character size
 void OLED_textsize(uint8_t size) {
@@ -294,27 +498,38 @@ void OLED_plotChar(char c) {
   if(OLED_sz == 0) {                              // normal character (5x8)
   #endif
     if(OLED_x > OLED_WIDTH - 6) OLED_cursor(0, OLED_y + 1);
-    I2C_start(OLED_ADDR << 1);                    // start transmission to OLED
-    I2C_write(OLED_DAT_MODE);                     // set data mode
-    I2C_write(OLED_i ? 0xff : 0x00);              // write space between characters
-    for(uint8_t i=5; i; i--) I2C_write(OLED_i ? ~OLED_FONT[ptr++] : OLED_FONT[ptr++]);
-    I2C_stop();
+    #if OLED_CACHE > 0
+    OLED_cacheClear(OLED_x, 6);
+    #endif
+    OLED_start();                                 // start transmission to OLED
+    OLED_ctrl(OLED_DAT_MODE);                     // set data mode
+    uint8_t inv = OLED_i ? 0xff : 0x00;           // inversion mask
+    OLED_send(inv);                               // write space between characters
+    for(uint8_t i=5; i; i--) OLED_send(OLED_FONT[ptr++] ^ inv);
+    OLED_end();
     OLED_x += 6;                                  // move cursor
   #if OLED_BIGCHARS > 0
   }
   else if(OLED_sz == 1) {                         // v-stretched character (5x16)
     if(OLED_x > OLED_WIDTH - 6) OLED_cursor(0, OLED_y + 2);
+    #if OLED_BIGCHARS == 2
+    OLED_drawBitmap(&OLED_FONT_5X16[ptr << 1], 5, 2); // -> (ch - 32) * 10
+    #else
     for(uint8_t i=0; i<5; i++) {
       uint16_t ch = OLED_stretch(OLED_FONT[ptr++]);
       OLED_buf[i] = ch; OLED_buf[i+5] = ch >> 8;
     }
     OLED_drawBitmap(OLED_buf, 5, 2);
+    #endif
     OLED_clearRect(1, 2);
   }
   else {                                          // double-sized smoothed character (10x16)
+    if(OLED_x > OLED_WIDTH - 12) OLED_cursor(0, OLED_y + 2);
+    #if OLED_BIGCHARS == 2
+    OLED_drawBitmap(&OLED_FONT_10X16[ptr << 2], 10, 2); // -> (ch - 32) * 20
+    #else
     uint16_t col0L, col0R, col1L, col1R;          // David Johnson-Davies' Smooth Big Text algorithm
     uint8_t col0 = OLED_FONT[ptr++];
-    if(OLED_x > OLED_WIDTH - 12) OLED_cursor(0, OLED_y + 2);
     col0L = OLED_stretch(col0);
     col0R = col0L;
     for(uint8_t col=0; col<10; col+=2) {
@@ -335,6 +550,7 @@ void OLED_plotChar(char c) {
       col0 = col1; col0L = col1L; col0R = col1R;
     }
     OLED_drawBitmap(OLED_buf, 10, 2);
+    #endif
     OLED_clearRect(2, 2);
   }
   #endif
@@ -361,56 +577,252 @@ void OLED_print(char* str) {
 // OLED Bitmap Functions
 // ===================================================================================
 
+#if OLED_CACHE > 0
+// Cells of full screen height currently shown (w = 0: unused, bmp = NULL: blank)
+typedef struct {
+  const uint8_t* bmp;
+  uint8_t x, w;
+} OLED_CELL;
+
+OLED_CELL OLED_cell[OLED_CACHE_SIZE];
+
+// Forget cells overlapping columns x .. x+w-1
+void OLED_cacheClear(uint8_t x, uint8_t w) {
+  OLED_CELL* c = OLED_cell;
+  for(uint8_t i=OLED_CACHE_SIZE; i; i--, c++) {
+    if(c->w && (c->x < x + w) && (x < c->x + c->w)) c->w = 0;
+  }
+}
+
+// Check if bitmap (bmp) or blank (bmp = NULL) is shown at cursor position already,
+// otherwise remember it as it is drawn now
+uint8_t OLED_cacheCheck(const uint8_t* bmp, uint8_t w, uint8_t h) {
+  uint8_t x = OLED_x;
+  uint8_t i, pos;
+  OLED_CELL* c;
+  if((h != OLED_HEIGHT / 8) || OLED_y || OLED_i) { // not a full-height cell
+    OLED_cacheClear(x, w);
+    return 0;
+  }
+  for(c=OLED_cell, i=OLED_CACHE_SIZE; i; i--, c++) { // same cell shown?
+    if((c->w == w) && (c->x == x) && (c->bmp == bmp)) return 1;
+  }
+  if(!bmp) {                                      // blank covered by blank cells?
+    pos = x;
+    do {
+      for(c=OLED_cell, i=OLED_CACHE_SIZE; i; i--, c++) {
+        if(c->w && !c->bmp && (c->x <= pos) && (pos < c->x + c->w)) break;
+      }
+      if(!i) break;
+      pos = c->x + c->w;
+    } while(pos < x + w);
+    if(pos >= x + w) return 1;
+  }
+  OLED_cacheClear(x, w);                          // replace overlapped cells
+  for(c=OLED_cell, i=OLED_CACHE_SIZE; i; i--, c++) {
+    if(!c->w) {
+      c->bmp = bmp; c->x = x; c->w = w;
+      break;
+    }
+  }
+  return 0;
+}
+#endif  // OLED_CACHE > 0
+
 // Draw bitmap (pointer *bmp) at cursor position width (w) in pixels, hight (h) in 8-pixel lines
-void OLED_drawBitmap(const uint8_t* bmp, uint8_t w, uint8_t h) {
+RAMFUNC void OLED_drawBitmap(const uint8_t* bmp, uint8_t w, uint8_t h) {
   uint8_t y = OLED_y;
+  #if OLED_CACHE > 0
+  if(OLED_cacheCheck(bmp, w, h)) {                // shown already?
+    OLED_cursor(OLED_x + w, y);                   // just move cursor
+    return;
+  }
+  #endif
+  uint8_t inv = OLED_i ? 0xff : 0x00;             // inversion mask
   while(h--) {
-    I2C_start(OLED_ADDR << 1);                    // start transmission to OLED
-    I2C_write(OLED_DAT_MODE);                     // set data mode
-    for(uint8_t i=w; i; i--) I2C_write(OLED_i ? ~(*bmp++) : *bmp++);
-    I2C_stop();
+    OLED_start();                                 // start transmission to OLED
+    OLED_ctrl(OLED_DAT_MODE);                     // set data mode
+    for(uint8_t i=w; i; i--) OLED_send(*bmp++ ^ inv);
+    OLED_end();
     OLED_cursor(OLED_x, OLED_y + 1);              // set next line
   }
   OLED_cursor(OLED_x + w, y);                     // move cursor
 }
 
+// Draw run-length encoded bitmap (see tools/bitmap_rle.py) at cursor position, width
+// (w) in pixels, hight (h) in 8-pixel lines. Decoded on the fly into the I2C stream:
+// control byte 0x00-0x7F: (control + 1) literal bytes follow,
+// control byte 0x80-0xFF: next byte is repeated (control - 0x80 + 3) times.
+RAMFUNC void OLED_drawBitmapRLE(const uint8_t* bmp, uint8_t w, uint8_t h) {
+  uint8_t y = OLED_y;
+  #if OLED_CACHE > 0
+  if(OLED_cacheCheck(bmp, w, h)) {                // shown already?
+    OLED_cursor(OLED_x + w, y);                   // just move cursor
+    return;
+  }
+  #endif
+  uint8_t cnt = 0;                                // bytes left in current block
+  uint8_t run = 0;                                // current block is a run
+  uint8_t val = 0;                                // current byte
+  uint8_t inv = OLED_i ? 0xff : 0x00;             // inversion mask
+  while(h--) {
+    OLED_start();                                 // start transmission to OLED
+    OLED_ctrl(OLED_DAT_MODE);                     // set data mode
+    for(uint8_t i=w; i; i--) {
+      if(!cnt) {                                  // start of next block?
+        cnt = *bmp++;                             // read control byte
+        run = cnt & 0x80;
+        if(run) {
+          cnt -= 0x80 - 3;                        // run length
+          val  = *bmp++;                          // byte to repeat
+        }
+        else cnt++;                               // literal length
+      }
+      if(!run) val = *bmp++;                      // read literal byte
+      cnt--;
+      OLED_send(val ^ inv);
+    }
+    OLED_end();
+    OLED_cursor(OLED_x, OLED_y + 1);              // set next line
+  }
+  OLED_cursor(OLED_x + w, y);                     // move cursor
+}
+
+// Draw display list on SH1106 (page addressing): the window headers only give
+// position and width, the data of each window is sent page by page
+void OLED_drawListPaged(const uint8_t* list) {
+  uint8_t  hdr, run, x = 0, y = 0, w = 1, col;
+  uint16_t cnt;
+  while((hdr = *list++)) {
+    if(hdr == OLED_DL_NEXT) continue;             // transactions follow the pages
+    if(hdr & 0x80) {                              // RLE data?
+      cnt   = *list++;
+      cnt  |= (uint16_t)(*list++) << 8;           // number of decoded bytes
+      col   = 0;                                  // no page started yet
+      while(cnt) {
+        hdr = *list++;                            // read control byte
+        run = hdr & 0x80;
+        hdr = run ? hdr - (0x80 - 3) : hdr + 1;   // block length
+        cnt -= hdr;
+        while(hdr--) {
+          if(!col) {                              // start of next page?
+            OLED_cursor(x, y++);
+            OLED_start();                         // start transmission to OLED
+            OLED_ctrl(OLED_DAT_MODE);             // set data mode
+            col = w;
+          }
+          OLED_send(*list);
+          if(!run) list++;
+          if(!--col) OLED_end();                  // end of page
+        }
+        if(run) list++;
+      }
+    }
+    else {                                        // window header
+      x = list[3] - OLED_XOFF;
+      w = list[5] - list[3] + 1;
+      y = list[9];
+      #if OLED_CACHE > 0
+      OLED_cacheClear(x, w);
+      #endif
+      list += hdr;
+    }
+  }
+}
+
+// Draw display list (see tools/displaylist.py), then reset window to full screen
+void OLED_drawList(const uint8_t* list) {
+  uint8_t  hdr;
+  uint16_t cnt;
+  if(OLED_DEV_SH1106) {                           // no horizontal addressing
+    OLED_drawListPaged(list);
+    return;
+  }
+  OLED_start();                                   // start transmission to OLED
+  while((hdr = *list++)) {
+    if(hdr == OLED_DL_NEXT) {                     // next transaction?
+      OLED_end();
+      OLED_start();
+    }
+    else if(hdr & 0x80) {                         // RLE data?
+      cnt   = *list++;
+      cnt  |= (uint16_t)(*list++) << 8;           // number of decoded bytes
+      while(cnt) {
+        hdr = *list++;                            // read control byte
+        if(hdr & 0x80) {                          // run block
+          hdr -= 0x80 - 3;
+          cnt -= hdr;
+          while(hdr--) OLED_send(*list);
+          list++;
+        }
+        else {                                    // literal block
+          hdr++;
+          cnt -= hdr;
+          while(hdr--) OLED_send(*list++);
+        }
+      }
+    }
+    else {                                        // control and command bytes
+      #if OLED_CACHE > 0
+      if((list[0] == OLED_CMD_ONCE) && (list[1] == OLED_COLUMNS)) // window header?
+        OLED_cacheClear(list[3] - OLED_XOFF, list[5] - list[3] + 1);
+      #endif
+      while(hdr--) {
+        OLED_ctrl(*list);                         // control byte
+        if(*list++ & OLED_CMD_ONCE) {             // one byte follows?
+          OLED_send(*list++);
+          hdr--;
+        }
+      }
+    }
+  }
+  OLED_end();
+  OLED_window(OLED_XOFF, OLED_XOFF + OLED_WIDTH - 1, 0, OLED_HEIGHT / 8 - 1); // full screen
+}
+
 // ===================================================================================
 // OLED 7-Segment Functions
 // ===================================================================================
 
 // Clear a rectangle starting from cursor position
-void OLED_clearRect(uint8_t w, uint8_t h) {
+RAMFUNC void OLED_clearRect(uint8_t w, uint8_t h) {
   uint8_t y = OLED_y;
+  #if OLED_CACHE > 0
+  if(OLED_cacheCheck(0, w, h)) {                  // shown already?
+    OLED_cursor(OLED_x + w, y);                   // just move cursor
+    return;
+  }
+  #endif
   while(h--) {
-    I2C_start(OLED_ADDR << 1);                    // start transmission to OLED
-    I2C_write(OLED_DAT_MODE);                     // set data mode
-    for(uint8_t i=w; i; i--) I2C_write(OLED_i ? 0xff : 0x00); // clear line
-    I2C_stop();                                   // stop transmission
+    OLED_start();                                 // start transmission to OLED
+    OLED_ctrl(OLED_DAT_MODE);                     // set data mode
+    for(uint8_t i=w; i; i--) OLED_send(OLED_i ? 0xff : 0x00); // clear line
+    OLED_end();                                   // stop transmission
     OLED_cursor(OLED_x, OLED_y + 1);              // set next line
   }
   OLED_cursor(OLED_x + w, y);                     // move cursor
 }
 
-// Print value as 7-segment digits (BCD conversion by substraction method)
+// Print value as 7-segment digits (BCD conversion by double dabble)
 void OLED_printSegment(uint16_t value, uint8_t digits, uint8_t lead, uint8_t decimal) {
-  static const uint16_t DIVIDER[] = {1, 10, 100, 1000, 10000};
+  uint32_t bcd = ARITH_bcd(value) << ((8 - digits) << 2); // first digit in top nibble
   uint8_t leadflag = 0;                           // flag for leading spaces
   while(digits--) {                               // for all digits digits
-    uint8_t digitval = 0;                         // start with digit value 0
-    uint16_t divider = DIVIDER[digits];           // read current divider
-    while(value >= divider) {                     // if current divider fits into the value
-      leadflag = 1;                               // end of leading spaces
-      digitval++;                                 // increase digit value
-      value -= divider;                           // decrease value by divider
-    }
+    uint8_t digitval = bcd >> 28;                 // read current digit
+    bcd <<= 4;                                    // next digit
+    if(digitval) leadflag = 1;                    // end of leading spaces
     if(digits == decimal) leadflag++;             // end leading characters before decimal
     if(leadflag || !lead) {
       #if OLED_SEG_FONT == 0
       OLED_write(digitval + '0');
       #elif OLED_SEG_FONT == 1
+      #if OLED_SEG_RLE > 0
+      OLED_drawBitmapRLE(&OLED_FONT_SEG_RLE[OLED_FONT_SEG_RLE_IDX[digitval]], 13, 4);
+      #else
       uint16_t ptr = (uint16_t)digitval;          // character pointer
       ptr = (ptr << 5) + (ptr << 4) + (ptr << 2); // -> ptr = c * 13 * 4;
       OLED_drawBitmap((uint8_t*)&OLED_FONT_SEG[ptr], 13, 4);
+      #endif
       #elif OLED_SEG_FONT == 2
       uint16_t ptr = (uint16_t)digitval;          // character pointer
       ptr = (ptr << 3) + (ptr << 1);              // -> ptr = c * 5 * 2;
@@ -7,12 +7,19 @@
 //
 // Functions available:
 // --------------------
-// OLED_init()                  Init OLED display
+// OLED_init()                  Init OLED display (on with OLED_display(1) if OLED_INIT_ON is 0),
+//                              returns 0 if autodetection found no OLED
 // OLED_display(v)              Switch display on/off (0: display off, 1: display on)
 // OLED_contrast(v)             Set OLED contrast (0-255)
 // OLED_invert(v)               Invert display (0: inverse off, 1: inverse on)
 // OLED_flip(xflip,yflip)       Flip display (0: flip off, 1: flip on)
 // OLED_vscroll(y)              Scroll display vertically (0-64)
+// OLED_window(x0,x1,y0,y1)     Set RAM window for writing (columns, pages; SSD1306)
+// OLED_startline(y)            Set RAM line shown at the top of the screen (0-63)
+// OLED_clearHidden()           Clear RAM lines below OLED_HEIGHT (SSD1306, height < 64)
+// OLED_marquee(y,sp,left)      Scroll line y continuously (SSD1306), speed (sp) is one of
+//                              OLED_SCROLL_2..256, (left) 0: to the right, 1: to the left
+// OLED_marqueeStop()           Stop scrolling, the line must be redrawn afterwards
 // OLED_clear()                 Clear screen of OLED display
 // OLED_clearLine(y)            Clear line y
 //
@@ -26,9 +33,84 @@
 //                              decimal point at position (dp) counted from the right
 // OLED_drawBitmap(bmp,w,h)     Draw bitmap (pointer *bmp) at cursor position 
 //                              width (w) in pixels, hight (h) in 8-pixel lines
+// OLED_drawBitmapRLE(bmp,w,h)  Draw run-length encoded bitmap (see tools/bitmap_rle.py)
+// OLED_drawList(list)          Draw precompiled display list (see tools/displaylist.py)
 //
-// If print functions are activated (see below, print.h must be included):
-// -----------------------------------------------------------------------
+// Big fonts (OLED_BIGCHARS, see below):
+// -------------------------------------
+// 1: 5x16 and 10x16 characters are converted from the 5x8 font at runtime (stretching
+//    via nibble table, smoothing for 10x16), roughly 80 / 1000 cycles per character
+//    in addition to the I2C transfer.
+// 2: 5x16 and 10x16 fonts are precomputed in ssd1306_bigfont.c (tools/bigfont.py)
+//    and copied straight to the display, no conversion, 2880 bytes of flash.
+//
+// Cell cache (OLED_CACHE, see below):
+// -----------------------------------
+// Bitmaps and blank rectangles over the full screen height (e.g. segment digits) are
+// remembered with their column and width. Drawing the same bitmap or a blank at the
+// same place again only moves the cursor, so a new frequency only sends the digits
+// that changed and a mode switch keeps the blank areas both screens have in common.
+// Text, display lists and other bitmaps make the cells they overlap unknown again.
+// Bitmaps from RAM must not be drawn over the full height while the cache is on.
+//
+// Marquee (SSD1306 only):
+// -----------------------
+// OLED_marquee() lets the controller rotate the 128 RAM columns of one line by
+// itself, with no CPU time and no I2C traffic until it is stopped. The label (up to
+// 21 characters in the 5x8 font) is drawn into the line first; it wraps around the
+// line with the unused columns as gap. While scrolling is active nothing may be
+// written to the OLED RAM (datasheet), so stop the marquee before redrawing.
+//
+// Autodetection (OLED_AUTODETECT, see below):
+// -------------------------------------------
+// OLED_init() calls OLED_detect() (I2C only), which probes OLED_ADDR and then
+// OLED_ADDR_ALT. If neither answers, it returns 0 and keeps OLED_ADDR and OLED_SH1106,
+// and OLED_init() returns 0 without sending anything; main.c then leaves the OLED
+// alone and runs the transmitter without display. With OLED_AUTODETECT 1 it also
+// reads the status byte to tell the SSD1306 from the SH1106 (a heuristic, see
+// ssd1306_txt.c). With 2 (default) the controller is set by OLED_SH1106. This adds
+// up to 0.1ms to the boot. On the SSD1306 everything works as without
+// autodetection (OLED_XOFF, horizontal addressing). On the SH1106 the columns are
+// shifted by 2, display lists and the strip renderer are sent page by page and
+// OLED_clearHidden() clears the 132-column pages. OLED_window() does
+// nothing on the SH1106, the console and the marquee remain SSD1306 only.
+//
+// Transport (OLED_TRANSPORT, see below):
+// --------------------------------------
+// All functions talk to the OLED through OLED_start(), OLED_ctrl(c) (I2C control
+// byte: OLED_CMD_MODE, OLED_DAT_MODE, ...), OLED_send(b) and OLED_end(). They are
+// selected at compile time, so there is no function pointer per byte:
+// 0: I2C polled, the calls map directly to I2C_start/I2C_write/I2C_stop.
+// 1: I2C with DMA (set I2C_DMA in i2c_tx.h). Bytes are collected in a double buffer
+//    of 2 x OLED_TX_BUF bytes, a full half is sent via DMA while the other one is
+//    filled. OLED_end() waits only for the last buffer half and releases the bus.
+// 2: 4-wire SPI1 (SCK: PC5, MOSI: PC6, CS: SPI_CS in spi_tx.h, D/C: OLED_SPI_DC,
+//    reset: OLED_SPI_RES) with DMA, same buffering. Control bytes set the D/C pin
+//    and are not sent. The SSD1306 takes up to 10MHz, F_CPU / 2 with 8MHz.
+// Full screen (4 pages of 128 bytes) at F_CPU 8MHz: I2C 381kHz about 12.5ms, the
+// CPU waits for every byte (0) or only when both buffer halves are full and for the
+// last half at OLED_end(), so work while a transmission is filled (e.g. decoding
+// RLE data) overlaps with the transfer (1). SPI 4MHz about 1.1ms (2).
+//
+// Display lists (SSD1306 only):
+// ------------------------------
+// Static screen parts are compiled by tools/displaylist.py into a flash array that
+// holds the ready-made I2C stream. Each rectangle is sent in a single transaction:
+// the column/page window commands (with continuation control bytes) followed by the
+// run-length encoded data, which wraps inside the window. OLED_drawList() only
+// decodes and copies, afterwards the window is reset to the full screen. A list
+// consists of blocks starting with a header byte:
+//   0x01 - 0x7F                (header) bytes follow: control bytes, each followed by
+//                              one command byte if its Co bit (0x80) is set
+//   OLED_DL_NEXT               stop transmission and start the next one
+//   OLED_DL_RLE(n)             RLE data follows (see tools/bitmap_rle.py), n bytes
+//   OLED_DL_END                end of list
+// OLED_DL_WINDOW(x,w,y,h) is the header block of a rectangle at column (x), page (y)
+// with width (w) in pixels and height (h) in 8-pixel lines. Text inversion does not
+// apply to display lists.
+//
+// If print functions are activated (see below, uses print.h):
+// ------------------------------------------------------------
 // OLED_printf(f, ...)          printf (supports %s, %c, %d, %u, %x, %b, %02d, %%)
 // OLED_printD(n)               Print decimal value
 // OLED_printW(n)               Print 32-bit hex word value
@@ -65,6 +147,7 @@ extern "C" {
 #endif
 
 #include "i2c_tx.h"                 // choose your I2C library
+#include "spi_tx.h"
 #include "system.h"
 
 // OLED Parameters
@@ -72,18 +155,43 @@ extern "C" {
 #define OLED_WIDTH        128       // OLED width in pixels
 #define OLED_HEIGHT       32        // OLED height in pixels
 #define OLED_SH1106       0         // OLED driver - 0: SSD1306/SH1107, 1: SH1106
+#ifndef OLED_AUTODETECT
+  #define OLED_AUTODETECT 2         // detect at OLED_init() 1: address and SSD1306/SH1106,
+#endif                              //                       2: address only, 0: off
+#define OLED_ADDR_ALT     0x3D      // second address tried by autodetection
+
+// Screen offsets
+#if OLED_SH1106 == 1 && OLED_AUTODETECT == 0
+  #define OLED_XOFF ((128 - OLED_WIDTH) / 2) + 2
+#else
+  #define OLED_XOFF ((128 - OLED_WIDTH) / 2)
+#endif
 
 #define OLED_BOOT_TIME    50        // OLED boot up time in milliseconds
 #define OLED_INIT_I2C     0         // 1: init I2C with OLED_init()
 #define OLED_XFLIP        1         // 1: flip screen in X-direction with OLED_init()
 #define OLED_YFLIP        1         // 1: flip screen in Y-direction with OLED_init()
 #define OLED_INVERT       0         // 1: invert screen with OLED_init()
+#define OLED_INIT_ON      0         // 1: switch display on with OLED_init()
+
+// OLED Transport (see above)
+#define OLED_TRANSPORT    0         // 0: I2C polled, 1: I2C + DMA, 2: SPI1 + DMA (4-wire)
+#define OLED_TX_BUF       32        // DMA transports: bytes per half of the double buffer
+#define OLED_SPI_DC       PC3       // SPI: data/command pin
+#define OLED_SPI_RES      PC7       // SPI: reset pin (active low)
 
 // OLED Text Settings
-#define OLED_PRINT        0         // 1: include print functions (needs print.h)
-#define OLED_BIGCHARS     0         // 1: use big fonts (OLED_textsize())
+#define OLED_PRINT        0         // 1: include print functions (print.h)
+#define OLED_BIGCHARS     0         // 1: use big fonts (OLED_textsize()), 2: precomputed
 #define OLED_SEG_FONT     1         // 0: standard font, 1: 13x32 digits, 2: 5x16 digits
 #define OLED_SEG_SPACE    3         // width of space between segment digits in pixels
+#ifndef OLED_SEG_RLE
+  #define OLED_SEG_RLE    1         // 1: store 13x32 digits run-length encoded
+#endif
+#ifndef OLED_CACHE
+  #define OLED_CACHE      1         // 1: skip redrawing unchanged full-height cells
+#endif
+#define OLED_CACHE_SIZE   12        // number of cells remembered (8 bytes RAM each)
 
 // OLED Modes
 #define OLED_CMD_MODE     0x00      // set command mode
@@ -91,12 +199,55 @@ extern "C" {
 #define OLED_CMD_ONCE     0x80      // send one command byte
 #define OLED_DAT_ONCE     0xC0      // send one data byte
 
+// OLED Device (address, controller and column offset at runtime with autodetection)
+#if OLED_AUTODETECT > 0
+  #if OLED_TRANSPORT == 2
+    #error OLED_AUTODETECT needs an I2C transport (set it to 0 for SPI)
+  #endif
+  extern uint8_t OLED_addr;         // detected I2C address
+  extern uint8_t OLED_sh1106;       // detected controller (1: SH1106)
+  uint8_t OLED_detect(void);        // detect address and controller (0: not found)
+  #define OLED_DEV_ADDR   OLED_addr
+  #define OLED_DEV_SH1106 OLED_sh1106
+  #define OLED_DEV_XOFF   (OLED_XOFF + (OLED_sh1106 << 1))
+#else
+  #define OLED_DEV_ADDR   OLED_ADDR
+  #define OLED_DEV_SH1106 OLED_SH1106
+  #define OLED_DEV_XOFF   OLED_XOFF
+#endif
+
+// OLED Transport Functions
+#if OLED_TRANSPORT == 0
+  #define OLED_start()    I2C_start(OLED_DEV_ADDR << 1) // start transmission
+  #define OLED_ctrl(c)    I2C_write(c)              // control byte (mode)
+  #define OLED_send(b)    I2C_write(b)              // command or data byte
+  #define OLED_end()      I2C_stop()                // stop transmission
+#else
+  #if OLED_TRANSPORT == 1 && I2C_DMA == 0
+    #error OLED_TRANSPORT 1 needs I2C_DMA 1 (i2c_tx.h)
+  #endif
+  extern uint8_t* OLED_txPtr;       // next free byte in buffer
+  extern uint8_t* OLED_txLim;       // end of buffer half
+  void OLED_txFlush(void);          // send buffer via DMA
+  void OLED_start(void);            // start transmission
+  void OLED_ctrl(uint8_t c);        // control byte (mode)
+  void OLED_end(void);              // stop transmission
+  static inline void OLED_send(uint8_t b) { // command or data byte
+    *OLED_txPtr++ = b;
+    if(OLED_txPtr == OLED_txLim) OLED_txFlush();
+  }
+#endif
+
 // OLED Commands
 #define OLED_COLUMN_LOW   0x00      // set lower 4 bits of start column (0x00 - 0x0F)
 #define OLED_COLUMN_HIGH  0x10      // set higher 4 bits of start column (0x10 - 0x1F)
 #define OLED_MEMORYMODE   0x20      // set memory addressing mode (following byte)
 #define OLED_COLUMNS      0x21      // set start and end column (following 2 bytes)
 #define OLED_PAGES        0x22      // set start and end page (following 2 bytes)
+#define OLED_SCROLL_RIGHT 0x26      // set up continuous right scroll (following 6 bytes)
+#define OLED_SCROLL_LEFT  0x27      // set up continuous left scroll (following 6 bytes)
+#define OLED_SCROLL_OFF   0x2E      // deactivate scroll
+#define OLED_SCROLL_ON    0x2F      // activate scroll
 #define OLED_STARTLINE    0x40      // set display start line (0x40-0x7F = 0-63)
 #define OLED_CONTRAST     0x81      // set display contrast (following byte, 0-255)
 #define OLED_CHARGEPUMP   0x8D      // (following byte - 0x14:enable, 0x10: disable)
@@ -118,13 +269,28 @@ extern "C" {
 #define OLED_COMPINS      0xDA      // set COM pin config (following byte)
 #define OLED_VCOM_DETECT  0xDB      // set VCOM detect (following byte)
 
+// OLED Scroll Speeds (frames per column step, for OLED_marquee())
+#define OLED_SCROLL_2     0x07      // 2 frames
+#define OLED_SCROLL_3     0x04      // 3 frames
+#define OLED_SCROLL_4     0x05      // 4 frames
+#define OLED_SCROLL_5     0x00      // 5 frames
+#define OLED_SCROLL_25    0x06      // 25 frames
+#define OLED_SCROLL_64    0x01      // 64 frames
+#define OLED_SCROLL_128   0x02      // 128 frames
+#define OLED_SCROLL_256   0x03      // 256 frames
+
 // OLED Control Functions
-void OLED_init(void);               // OLED init function
+uint8_t OLED_init(void);            // OLED init function (0: OLED not found)
 void OLED_display(uint8_t val);     // Switch display on/off (0: display off, 1: display on)
 void OLED_contrast(uint8_t val);    // Set display contrast (0-255)
 void OLED_invert(uint8_t val);      // Invert display (0: inverse off, 1: inverse on)
 void OLED_flip(uint8_t xflip, uint8_t yflip); // Flip display (0: flip off, 1: flip on)
 void OLED_vscroll(uint8_t y);       // Scroll display vertically (0-64)
+void OLED_window(uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1); // Set RAM window
+void OLED_startline(uint8_t y);     // Set RAM line shown at the top of the screen (0-63)
+void OLED_clearHidden(void);        // Clear RAM lines below OLED_HEIGHT
+void OLED_marquee(uint8_t y, uint8_t speed, uint8_t left); // Scroll line y continuously
+void OLED_marqueeStop(void);        // Stop scrolling
 
 // OLED Text Functions
 void OLED_clear(void);              // Clear screen
@@ -140,8 +306,24 @@ void OLED_textsize(uint8_t size);   // Set text size (0: 5x8, 1: 5x16, 2: 10x16)
 
 // OLED Special Functions
 void OLED_drawBitmap(const uint8_t* bmp, uint8_t w, uint8_t h);
+void OLED_drawBitmapRLE(const uint8_t* bmp, uint8_t w, uint8_t h);
 void OLED_clearRect(uint8_t w, uint8_t h);
 void OLED_printSegment(uint16_t value, uint8_t digits, uint8_t lead, uint8_t decimal);
+void OLED_drawList(const uint8_t* list);
+
+#if OLED_CACHE > 0
+void OLED_cacheClear(uint8_t x, uint8_t w); // Forget cells overlapping columns x..x+w-1
+#endif
+
+// Display List Blocks
+#define OLED_DL_END           0x00
+#define OLED_DL_NEXT          0x80
+#define OLED_DL_RLE(n)        0x81, (uint8_t)(n), (uint8_t)((n) >> 8)
+#define OLED_DL_WINDOW(x,w,y,h) 13,                                                 \
+        OLED_CMD_ONCE, OLED_COLUMNS, OLED_CMD_ONCE, (x) + OLED_XOFF,                \
+        OLED_CMD_ONCE, (x) + (w) - 1 + OLED_XOFF,                                   \
+        OLED_CMD_ONCE, OLED_PAGES,   OLED_CMD_ONCE, (y), OLED_CMD_ONCE, (y) + (h) - 1, \
+        OLED_DAT_MODE
 
 #define OLED_textcolor(c)     OLED_textinvert(!(c))
 
@@ -103,6 +103,40 @@ void DLY_ticks(uint32_t n) {
   while(((int32_t)(STK->CNT - end)) < 0);
 }
 
+// Delay variable n microseconds (DLY_us() with constant n needs no multiplication)
+void DLY_usLoop(uint32_t n) {
+  uint32_t end = STK->CNT;
+  while(n--) {
+    end += DLY_US_TIME;
+    while(((int32_t)(STK->CNT - end)) < 0);
+  }
+}
+
+// Delay variable n milliseconds
+void DLY_msLoop(uint32_t n) {
+  uint32_t end = STK->CNT;
+  while(n--) {
+    end += DLY_MS_TIME;
+    while(((int32_t)(STK->CNT - end)) < 0);
+  }
+}
+
+// ===================================================================================
+// Millisecond Counter (MIL) Functions
+// ===================================================================================
+uint32_t MIL_last;                      // SYSTICK value of last counted millisecond
+uint32_t MIL_count;                     // milliseconds since start
+
+// Return milliseconds since start. SYSTICK wraps around every 2^32 clock cycles, so
+// this has to be called at least every 80 seconds (at 48MHz) to keep track.
+uint32_t MIL_read(void) {
+  while((STK->CNT - MIL_last) >= DLY_MS_TIME) {
+    MIL_last += DLY_MS_TIME;
+    MIL_count++;
+  }
+  return MIL_count;
+}
+
 // ===================================================================================
 // Bootloader (BOOT) Functions
 // ===================================================================================
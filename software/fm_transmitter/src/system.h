@@ -45,6 +45,11 @@
 // DLY_us(n)                delay n microseconds
 // DLY_ms(n)                delay n milliseconds
 //
+// Millisecond counter (MIL) functions available:
+// ----------------------------------------------
+// MIL_read()               milliseconds since start (based on SYSTICK, must be called
+//                          at least every 80 seconds to keep track)
+//
 // Reset (RST) and Bootloader (BOOT) functions available:
 // ------------------------------------------------------
 // BOOT_now()               conduct software reset and jump to bootloader
@@ -107,6 +112,26 @@
 // INT_disable()            global interrupt disable
 // INT_ATOMIC_BLOCK { }     execute block without being interrupted
 //
+// Code placement:
+// ---------------
+// RAMFUNC                  function attribute, the function is copied into RAM on
+//                          startup and executed from there (no flash wait state)
+//
+// At F_CPU > 24MHz flash needs one wait state, so tight loops run faster from RAM.
+// RAMFUNC is opt-in: it has no effect at lower clock rates (the default build runs
+// at 8MHz) or if SYS_USE_RAMFUNC is 0, so no RAM is wasted. SYS_USE_RAMFUNC 2 places
+// the functions in RAM at any clock rate, e.g. to check the RAM budget. The linker
+// script checks that RAM functions (512 bytes max), variables and a minimum stack
+// (256 bytes) fit into the 2K RAM.
+//
+// Tagged functions and rough estimates (hand-counted RV32EC code, not measured):
+// I2C_write() (hardware: about 16 bytes, software: about 120 bytes with the inlined
+// bit loop), OLED_drawBitmap(), OLED_drawBitmapRLE() and OLED_clearRect() (about
+// 100 to 150 bytes each), together about 400 bytes. From RAM every taken branch
+// saves the wait state of the jump target, about 1 of 4 to 6 cycles per iteration
+// of the byte loops. While waiting for the I2C bus this only shortens the reaction
+// time; it pays off for the data loops with the SPI transport or software I2C.
+//
 // References:
 // -----------
 // - CNLohr ch32v003fun: https://github.com/cnlohr/ch32v003fun
@@ -131,6 +156,7 @@ extern "C" {
 #define SYS_CLEAR_BSS     1         // 1: clear uninitialized variables
 #define SYS_USE_VECTORS   0         // 1: create interrupt vector table
 #define SYS_USE_HSE       0         // 1: use external crystal
+#define SYS_USE_RAMFUNC   1         // RAMFUNC from RAM, 1: if > 24MHz, 2: always
 
 // ===================================================================================
 // Sytem Clock Defines
@@ -190,6 +216,15 @@ extern "C" {
   #endif
 #endif
 
+// ===================================================================================
+// Code Placement
+// ===================================================================================
+#if SYS_USE_RAMFUNC > 1 || (SYS_USE_RAMFUNC > 0 && F_CPU > 24000000)
+  #define RAMFUNC         __attribute__((section(".ramfunc"), noinline))
+#else
+  #define RAMFUNC
+#endif
+
 // ===================================================================================
 // System Clock Functions
 // ===================================================================================
@@ -237,9 +272,18 @@ void MCO_init(void);                                    // init clock output to
 #define STK_init()        STK->CTLR = STK_CTLR_STE | STK_CTLR_STCLK // init SYSTICK @ F_CPU
 #define DLY_US_TIME       (F_CPU / 1000000)             // system ticks per us
 #define DLY_MS_TIME       (F_CPU / 1000)                // system ticks per ms
-#define DLY_us(n)         DLY_ticks((n) * DLY_US_TIME)  // delay n microseconds
-#define DLY_ms(n)         DLY_ticks((n) * DLY_MS_TIME)  // delay n milliseconds
+#define DLY_us(n)         (__builtin_constant_p(n) ? DLY_ticks((n) * DLY_US_TIME) \
+                                                   : DLY_usLoop(n)) // delay n us
+#define DLY_ms(n)         (__builtin_constant_p(n) ? DLY_ticks((n) * DLY_MS_TIME) \
+                                                   : DLY_msLoop(n)) // delay n ms
 void DLY_ticks(uint32_t n);                             // delay n system ticks
+void DLY_usLoop(uint32_t n);                            // delay variable n us
+void DLY_msLoop(uint32_t n);                            // delay variable n ms
+
+// ===================================================================================
+// Millisecond Counter (MIL) Functions
+// ===================================================================================
+uint32_t MIL_read(void);                                // milliseconds since start
 
 // ===================================================================================
 // Reset (RST) Functions
@@ -286,7 +330,7 @@ void AWU_stop(void);        // stop automatic wake-up timer
 #define AWU_sleep(ms)         {AWU_set(ms); SLEEP_WFE_now();}
 #define AWU_stdby(ms)         {AWU_set(ms); STDBY_WFE_now();}
 
-// Set automatic wake-up timer in milliseconds
+// Set automatic wake-up timer in milliseconds (ms should be a constant)
 #define AWU_set(ms) \
   (ms <    64 ? ({PWR->AWUPSC = 0b1000; PWR->AWUWR = (ms);    }) : \
   (ms <   128 ? ({PWR->AWUPSC = 0b1001; PWR->AWUWR = (ms)>>1; }) : \
@@ -0,0 +1,70 @@
+// ===================================================================================
+// Basic USART1 Functions with DMA Receive Ring Buffer for CH32V003           * v1.0 *
+// ===================================================================================
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#include "uart.h"
+
+// RX ring buffer (filled by DMA) and read index
+char    UART_buffer[UART_RX_SIZE];
+uint8_t UART_tail;
+
+// Init UART
+void UART_init(void) {
+  // Setup GPIO pins
+  RCC->APB2PCENR |= RCC_AFIOEN | RCC_IOPDEN | RCC_USART1EN;
+  #if UART_MAP == 0
+    // Set pin PD5 (TX) to output, push-pull, 10MHz, multiplex; PD6 (RX) to input, pullup
+    GPIOD->CFGLR = (GPIOD->CFGLR & ~(((uint32_t)0b1111<<(5<<2)) | ((uint32_t)0b1111<<(6<<2))))
+                                 |  (((uint32_t)0b1001<<(5<<2)) | ((uint32_t)0b1000<<(6<<2)));
+    GPIOD->BSHR  = (uint32_t)1<<6;
+  #elif UART_MAP == 1
+    // Set pin PD6 (TX) to output, push-pull, 10MHz, multiplex; PD5 (RX) to input, pullup
+    AFIO->PCFR1 |= (uint32_t)1<<21;
+    GPIOD->CFGLR = (GPIOD->CFGLR & ~(((uint32_t)0b1111<<(6<<2)) | ((uint32_t)0b1111<<(5<<2))))
+                                 |  (((uint32_t)0b1001<<(6<<2)) | ((uint32_t)0b1000<<(5<<2)));
+    GPIOD->BSHR  = (uint32_t)1<<5;
+  #else
+    #warning Wrong UART REMAP
+  #endif
+
+  // Setup RX DMA (USART1_RX is hard-wired to DMA1 channel 5), circular mode
+  RCC->AHBPCENR |= RCC_DMA1EN;                    // enable DMA module clock
+  DMA1_Channel5->PADDR = (uint32_t)&USART1->DATAR;// peripheral address
+  DMA1_Channel5->MADDR = (uint32_t)UART_buffer;   // ring buffer address
+  DMA1_Channel5->CNTR  = UART_RX_SIZE;            // ring buffer size
+  DMA1_Channel5->CFGR  = DMA_CFGR1_MINC           // increment memory address
+                       | DMA_CFGR1_CIRC           // circular mode
+                       | DMA_CFGR1_EN;            // enable channel
+
+  // Setup and enable UART (8N1, RX and TX)
+  USART1->BRR   = ((2 * F_CPU / UART_BAUD) + 1) / 2; // set baud rate (rounded)
+  USART1->CTLR3 = USART_CTLR3_DMAR;               // enable RX DMA requests
+  USART1->CTLR1 = USART_CTLR1_RE | USART_CTLR1_TE | USART_CTLR1_UE;
+}
+
+// Number of received bytes waiting in the ring buffer
+uint8_t UART_available(void) {
+  uint8_t head = UART_RX_SIZE - DMA1_Channel5->CNTR; // DMA write index
+  return (head - UART_tail) & (UART_RX_SIZE - 1);
+}
+
+// Read one byte from the ring buffer (waits if empty)
+char UART_read(void) {
+  char c;
+  while(!UART_available());                       // wait for data
+  c = UART_buffer[UART_tail++];                   // read byte
+  UART_tail &= (UART_RX_SIZE - 1);                // wrap around
+  return c;
+}
+
+// Send one byte via UART
+void UART_write(char c) {
+  while(!(USART1->STATR & USART_STATR_TXE));      // wait for transmit buffer empty
+  USART1->DATAR = c;                              // send byte
+}
+
+// Send string via UART
+void UART_print(const char* str) {
+  while(*str) UART_write(*str++);
+}
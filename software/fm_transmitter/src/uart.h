@@ -0,0 +1,47 @@
+// ===================================================================================
+// Basic USART1 Functions with DMA Receive Ring Buffer for CH32V003           * v1.0 *
+// ===================================================================================
+//
+// Functions available:
+// --------------------
+// UART_init()              Init UART with defined BAUD rate (8N1), start RX DMA
+// UART_available()         Number of received bytes waiting in the ring buffer
+// UART_read()              Read one byte from the ring buffer (waits if empty)
+// UART_write(c)            Send one byte via UART
+// UART_print(str)          Send string via UART
+//
+// UART pin mapping (set below in UART parameters):
+// ------------------------------------------------
+// UART_MAP     0     1
+// TX-pin      PD5   PD6
+// RX-pin      PD6   PD5
+//
+// Received bytes are written into the ring buffer by DMA1 channel 5 in circular
+// mode, no interrupt is needed. UART_available() must be polled often enough that
+// the buffer does not overflow (UART_RX_SIZE bytes).
+//
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "system.h"
+
+// UART Parameters
+#define UART_BAUD     115200    // UART baud rate (8N1)
+#define UART_MAP      0         // UART pin mapping (see above)
+#define UART_RX_SIZE  32        // RX ring buffer size in bytes (power of 2)
+
+// UART Functions
+void UART_init(void);           // init UART with defined BAUD rate, start RX DMA
+uint8_t UART_available(void);   // number of received bytes in ring buffer
+char UART_read(void);           // read one byte from ring buffer (waits if empty)
+void UART_write(char c);        // send one byte via UART
+void UART_print(const char* str); // send string via UART
+
+#ifdef __cplusplus
+};
+#endif
@@ -0,0 +1,229 @@
+// ===================================================================================
+// Host OLED Model for the Driver Tests
+// ===================================================================================
+// Virtual I2C bus with one SSD1306 or SH1106, see oled_model.h.
+
+#include <stdio.h>
+#include <string.h>
+#include "oled_model.h"
+#include "ssd1306_txt.h"
+
+// Device and display state
+uint8_t  MODEL_addr = OLED_ADDR, MODEL_sh1106 = OLED_SH1106, MODEL_status = 0x06;
+uint8_t  MODEL_ram[8][132];
+uint8_t  MODEL_on, MODEL_startline, MODEL_offset;
+uint8_t  MODEL_scroll, MODEL_scrollCmd, MODEL_scrollPage0, MODEL_scrollPage1;
+uint8_t  MODEL_scrollSpeed, MODEL_scrollDummy;
+uint32_t MODEL_tx, MODEL_bytes, MODEL_data, MODEL_bits, MODEL_nacked, MODEL_winerr;
+uint32_t MODEL_scrollWrites, MODEL_onBits;
+uint32_t MODEL_time;
+uint8_t  MODEL_last[32], MODEL_lastLen;
+uint16_t MODEL_fails;
+
+// Controller registers
+static uint8_t  MODEL_sel;              // 1: addressed in this transaction
+static uint8_t  MODEL_ctrl;             // 1: next byte is a control byte
+static uint8_t  MODEL_dat;              // 1: data mode
+static uint8_t  MODEL_once;             // 1: one byte, then control byte again
+static uint8_t  MODEL_cmd[8], MODEL_ncmd; // command being received
+static uint8_t  MODEL_mode;             // memory addressing mode (0: horizontal)
+static uint8_t  MODEL_col, MODEL_pg;    // RAM pointer
+static uint8_t  MODEL_col0, MODEL_col1 = 127, MODEL_pg0, MODEL_pg1 = 7; // window
+static uint16_t MODEL_frame;            // frames since last scroll step
+
+// Frames per scroll step for the speed codes OLED_SCROLL_x
+static const uint16_t MODEL_SPEED[8] = { 5, 64, 128, 256, 3, 4, 25, 2 };
+
+// Number of bytes of a command (SSD1306 and SH1106 command sets)
+static uint8_t MODEL_cmdLen(uint8_t c) {
+  if(c == OLED_COLUMNS || c == OLED_PAGES) return 3;
+  if(c == OLED_SCROLL_RIGHT || c == OLED_SCROLL_LEFT) return 7;
+  if(c == OLED_MEMORYMODE || c == OLED_CONTRAST || c == OLED_CHARGEPUMP ||
+     c == OLED_MULTIPLEX  || c == OLED_OFFSET   || c == OLED_CLOCK      ||
+     c == OLED_PRECHARGE  || c == OLED_COMPINS  || c == OLED_VCOM_DETECT ||
+     c == 0xAD) return 2;                         // 0xAD: SH1106 DC-DC control
+  return 1;
+}
+
+// Execute a complete command
+static void MODEL_exec(void) {
+  uint8_t c = MODEL_cmd[0];
+  if(c == OLED_COLUMNS || c == OLED_PAGES) {
+    if(MODEL_sh1106) { MODEL_winerr++; return; }  // SH1106 has no window
+    if(c == OLED_COLUMNS) { MODEL_col0 = MODEL_cmd[1]; MODEL_col1 = MODEL_cmd[2]; MODEL_col = MODEL_col0; }
+    else                  { MODEL_pg0  = MODEL_cmd[1]; MODEL_pg1  = MODEL_cmd[2]; MODEL_pg  = MODEL_pg0;  }
+  }
+  else if(c == OLED_SCROLL_RIGHT || c == OLED_SCROLL_LEFT) {
+    if(MODEL_sh1106) return;
+    MODEL_scrollCmd   = c;
+    MODEL_scrollPage0 = MODEL_cmd[2];
+    MODEL_scrollSpeed = MODEL_cmd[3];
+    MODEL_scrollPage1 = MODEL_cmd[4];
+    MODEL_scrollDummy = (MODEL_cmd[1] == 0x00) && (MODEL_cmd[5] == 0x00) && (MODEL_cmd[6] == 0xFF);
+  }
+  else if(c == OLED_SCROLL_OFF)               MODEL_scroll = 0;
+  else if(c == OLED_SCROLL_ON)                { if(!MODEL_sh1106) { MODEL_scroll = 1; MODEL_frame = 0; } }
+  else if(c == OLED_MEMORYMODE)               MODEL_mode = MODEL_cmd[1] & 3;
+  else if(c == OLED_OFFSET)                   MODEL_offset = MODEL_cmd[1] & 63;
+  else if(c == OLED_DISPLAY_ON)               { MODEL_on = 1; MODEL_onBits = MODEL_bits; }
+  else if(c == OLED_DISPLAY_OFF)              MODEL_on = 0;
+  else if((c & 0xF8) == OLED_PAGE)            MODEL_pg = c & 7;
+  else if((c & 0xC0) == OLED_STARTLINE)       MODEL_startline = c & 63;
+  else if(c < OLED_COLUMN_HIGH)               MODEL_col = (MODEL_col & 0xF0) | c;
+  else if(c < OLED_MEMORYMODE)                MODEL_col = (MODEL_col & 0x0F) | ((c & 0x0F) << 4);
+}
+
+// Write one byte into display RAM and move the RAM pointer
+static void MODEL_store(uint8_t b) {
+  MODEL_data++;
+  if(MODEL_scroll) MODEL_scrollWrites++;
+  if(MODEL_sh1106) {                              // page addressing, 132 columns
+    if(MODEL_col < 132) MODEL_ram[MODEL_pg][MODEL_col++] = b;
+    return;
+  }
+  MODEL_ram[MODEL_pg][MODEL_col & 127] = b;
+  if(MODEL_mode) {                                // page addressing
+    MODEL_col = (MODEL_col + 1) & 127;
+  }
+  else if(MODEL_col == MODEL_col1) {              // horizontal: wrap inside window
+    MODEL_col = MODEL_col0;
+    MODEL_pg  = (MODEL_pg == MODEL_pg1) ? MODEL_pg0 : (MODEL_pg + 1) & 7;
+  }
+  else MODEL_col++;
+}
+
+// ===================================================================================
+// Model Functions
+// ===================================================================================
+
+// Reset controller state and counters, RAM content stays
+void MODEL_reset(void) {
+  MODEL_on = 0; MODEL_startline = 0; MODEL_offset = 0; MODEL_mode = 0;
+  MODEL_col = MODEL_col0 = 0; MODEL_col1 = 127;
+  MODEL_pg  = MODEL_pg0  = 0; MODEL_pg1  = 7;
+  MODEL_scroll = 0; MODEL_scrollCmd = 0; MODEL_scrollDummy = 0;
+  MODEL_winerr = 0; MODEL_nacked = 0; MODEL_scrollWrites = 0; MODEL_onBits = 0;
+  MODEL_count();
+}
+
+// Fill display RAM
+void MODEL_fill(uint8_t val) {
+  memset(MODEL_ram, val, sizeof(MODEL_ram));
+}
+
+// Reset bus counters
+void MODEL_count(void) {
+  MODEL_tx = 0; MODEL_bytes = 0; MODEL_data = 0; MODEL_bits = 0;
+}
+
+// Let n display frames pass, the scroll rotates the columns of its pages
+void MODEL_frames(uint16_t n) {
+  uint8_t p, t;
+  while(n--) {
+    if(!MODEL_scroll || ++MODEL_frame < MODEL_SPEED[MODEL_scrollSpeed & 7]) continue;
+    MODEL_frame = 0;
+    for(p = MODEL_scrollPage0; p <= MODEL_scrollPage1 && p < 8; p++) {
+      if(MODEL_scrollCmd == OLED_SCROLL_LEFT) {
+        t = MODEL_ram[p][0];
+        memmove(&MODEL_ram[p][0], &MODEL_ram[p][1], 127);
+        MODEL_ram[p][127] = t;
+      }
+      else {
+        t = MODEL_ram[p][127];
+        memmove(&MODEL_ram[p][1], &MODEL_ram[p][0], 127);
+        MODEL_ram[p][0] = t;
+      }
+    }
+  }
+}
+
+// Visible pixel at column x, line y
+uint8_t MODEL_pixel(uint8_t x, uint8_t y) {
+  uint8_t row = (y + MODEL_startline + MODEL_offset) & 63;
+  x += ((128 - OLED_WIDTH) >> 1) + (MODEL_sh1106 << 1);
+  return (MODEL_ram[row >> 3][x] >> (row & 7)) & 1;
+}
+
+// Visible byte at column x, page y
+uint8_t MODEL_page(uint8_t x, uint8_t y) {
+  uint8_t i, b = 0;
+  for(i=0; i<8; i++) b |= MODEL_pixel(x, (y << 3) + i) << i;
+  return b;
+}
+
+// Copy visible screen, OLED_WIDTH bytes per page
+void MODEL_grab(uint8_t* scr) {
+  uint8_t x, y;
+  for(y=0; y<OLED_HEIGHT/8; y++)
+    for(x=0; x<OLED_WIDTH; x++) *scr++ = MODEL_page(x, y);
+}
+
+// Print and count check result
+void MODEL_check(const char* what, uint8_t ok) {
+  printf("  %-4s %s\n", ok ? "ok" : "FAIL", what);
+  if(!ok) MODEL_fails++;
+}
+
+// ===================================================================================
+// I2C Functions of the Firmware
+// ===================================================================================
+
+void I2C_init(void) {}
+
+// Start write transaction (addr with R/W bit)
+void I2C_start(uint8_t addr) {
+  MODEL_tx++; MODEL_bytes++; MODEL_bits += 10;
+  MODEL_sel  = ((addr >> 1) == MODEL_addr);
+  if(!MODEL_sel) MODEL_nacked++;
+  MODEL_ctrl = 1; MODEL_ncmd = 0; MODEL_lastLen = 0;
+}
+
+// Send one byte
+void I2C_write(uint8_t data) {
+  MODEL_bytes++; MODEL_bits += 9;
+  if(!MODEL_sel) return;
+  if(MODEL_lastLen < sizeof(MODEL_last)) MODEL_last[MODEL_lastLen++] = data;
+  if(MODEL_ctrl) {                                // control byte
+    MODEL_ctrl = 0;
+    MODEL_dat  = data & OLED_DAT_MODE;
+    MODEL_once = data & OLED_CMD_ONCE;
+    return;
+  }
+  if(MODEL_dat) MODEL_store(data);
+  else {
+    MODEL_cmd[MODEL_ncmd++] = data;
+    if(MODEL_ncmd >= MODEL_cmdLen(MODEL_cmd[0])) {
+      MODEL_exec();
+      MODEL_ncmd = 0;
+    }
+  }
+  if(MODEL_once) MODEL_ctrl = 1;
+}
+
+// Stop transaction
+void I2C_stop(void) {
+  MODEL_bits += 1;
+}
+
+void I2C_writeBuffer(uint8_t* buf, uint16_t len) {
+  while(len--) I2C_write(*buf++);
+  I2C_stop();
+}
+
+// Address-only transaction (1: device answers)
+uint8_t I2C_probe(uint8_t addr) {
+  MODEL_tx++; MODEL_bytes++; MODEL_bits += 11;
+  return addr == MODEL_addr;
+}
+
+// Read one byte (0xFF: no answer)
+uint8_t I2C_read(uint8_t addr) {
+  MODEL_tx++; MODEL_bytes += 2; MODEL_bits += 20;
+  return (addr == MODEL_addr) ? MODEL_status : 0xFF;
+}
+
+// Delays take no time, MIL_read() returns MODEL_time
+void DLY_ticks(uint32_t n) {}
+void DLY_usLoop(uint32_t n) {}
+void DLY_msLoop(uint32_t n) {}
+uint32_t MIL_read(void) { return MODEL_time; }
@@ -0,0 +1,67 @@
+// ===================================================================================
+// Host OLED Model for the Driver Tests
+// ===================================================================================
+// Replaces the I2C and delay functions of the firmware on the host with a virtual
+// I2C bus that has one SSD1306 or SH1106 on it. The model decodes the command and
+// data bytes into its display RAM (8 pages, 132 columns), so a test can compare the
+// visible screen with a reference and count the bytes each drawing step costs.
+//
+// SSD1306: horizontal and page addressing, column/page window, start line, display
+//          offset and continuous horizontal scroll (MODEL_frames() runs it).
+// SH1106:  page addressing over 132 columns, no window and no scroll commands.
+//          Window commands sent to it are counted in MODEL_winerr.
+//
+// The tests are built and run with 'make host-test'.
+
+#pragma once
+
+#include <stdint.h>
+
+// Device on the bus (set before the test, MODEL_reset() keeps them)
+extern uint8_t  MODEL_addr;             // 7-bit I2C address (default OLED_ADDR)
+extern uint8_t  MODEL_sh1106;           // 1: device is an SH1106
+extern uint8_t  MODEL_status;           // status byte returned by a read
+
+// Display state
+extern uint8_t  MODEL_ram[8][132];      // display RAM
+extern uint8_t  MODEL_on;               // 1: display is switched on
+extern uint8_t  MODEL_startline;        // display start line (0..63)
+extern uint8_t  MODEL_offset;           // display offset (0..63)
+extern uint32_t MODEL_time;             // milliseconds returned by MIL_read()
+
+// Scroll state (SSD1306)
+extern uint8_t  MODEL_scroll;           // 1: scroll is running
+extern uint8_t  MODEL_scrollCmd;        // last set up command (0x26 right, 0x27 left)
+extern uint8_t  MODEL_scrollPage0;      // first scrolled page
+extern uint8_t  MODEL_scrollPage1;      // last scrolled page
+extern uint8_t  MODEL_scrollSpeed;      // frames per step code (OLED_SCROLL_x)
+extern uint8_t  MODEL_scrollDummy;      // 1: dummy bytes of the set up are correct
+
+// Bus counters
+extern uint32_t MODEL_tx;               // transactions (write, probe and read)
+extern uint32_t MODEL_bytes;            // bytes incl. address bytes
+extern uint32_t MODEL_data;             // data bytes written to display RAM
+extern uint32_t MODEL_bits;             // bus bit times incl. START/STOP
+extern uint32_t MODEL_nacked;           // transactions to an address nobody answers
+extern uint32_t MODEL_winerr;           // window commands sent to an SH1106
+extern uint32_t MODEL_scrollWrites;     // data bytes written while the scroll runs
+extern uint32_t MODEL_onBits;           // MODEL_bits when the display was switched on
+
+// Last write transaction (control and payload bytes, without the address)
+extern uint8_t  MODEL_last[32];
+extern uint8_t  MODEL_lastLen;
+
+void MODEL_reset(void);                 // reset controller state and counters
+void MODEL_fill(uint8_t val);           // fill display RAM (garbage after power-up)
+void MODEL_count(void);                 // reset bus counters only
+void MODEL_frames(uint16_t n);          // let n display frames pass (scroll steps)
+uint8_t MODEL_page(uint8_t x, uint8_t y); // visible byte at column x, page y
+uint8_t MODEL_pixel(uint8_t x, uint8_t y); // visible pixel at column x, line y
+void MODEL_grab(uint8_t* scr);          // copy visible screen (OLED_HEIGHT/8 pages)
+
+// Test results
+extern uint16_t MODEL_fails;            // number of failed checks
+void MODEL_check(const char* what, uint8_t ok); // print and count check result
+
+// Bus time in milliseconds at 400kHz
+#define MODEL_ms(bits)  ((bits) / 400.0)
@@ -0,0 +1,69 @@
+// ===================================================================================
+// Host Test: Hardware-scrolled Text Console
+// ===================================================================================
+// Logs lines with CON_print() and checks the visible screen after every line, then
+// compares the bytes per line with redrawing the visible lines with OLED_print().
+
+#include <stdio.h>
+#include <string.h>
+#include "oled_model.h"
+#include "console.h"
+
+#define LINES         20                          // lines logged
+
+extern const uint8_t OLED_FONT[];
+
+char text[LINES][32];
+
+// Check that the screen shows the last CON_LINES of the (n) lines logged so far
+uint8_t shows(uint8_t n) {
+  uint8_t  exp[OLED_WIDTH];
+  uint8_t  v, x, c;
+  int      line;
+  for(v=0; v<CON_LINES; v++) {
+    line = (n < CON_LINES) ? v : n - CON_LINES + v;
+    memset(exp, 0, sizeof(exp));
+    if(line < n) {
+      for(c=0; text[line][c] && c<CON_COLS; c++)
+        memcpy(&exp[6 * c + 1], &OLED_FONT[(text[line][c] - 32) * 5], 5);
+    }
+    for(x=0; x<OLED_WIDTH; x++) if(MODEL_page(x, v) != exp[x]) return 0;
+  }
+  return 1;
+}
+
+int main(void) {
+  uint8_t  k, v, bad = 0;
+  uint32_t bytes = 0, last = 0;
+  char     pad[32];
+
+  printf("console:\n");
+  MODEL_fill(0xAA);
+  OLED_init();
+  CON_open();
+  for(k=0; k<LINES; k++) {
+    if(k % 3) snprintf(text[k], sizeof(text[k]), "line %u: f=98.%uMHz", k, k % 10);
+    else      snprintf(text[k], sizeof(text[k]), "#%u", k);
+    MODEL_count();
+    CON_print(text[k]);
+    CON_write('\n');
+    bytes += MODEL_bytes;
+    last   = MODEL_bytes;
+    if(!shows(k + 1)) bad++;
+  }
+  printf("  logged line: %u bytes (%.1f bytes on average)\n", (unsigned)last, bytes / (double)LINES);
+
+  // The same lines drawn with OLED_print
+  CON_close();
+  MODEL_count();
+  for(v=0; v<CON_LINES; v++) {
+    snprintf(pad, CON_COLS + 1, "%-21s", text[LINES - CON_LINES + v]);
+    OLED_cursor(0, v);
+    OLED_print(pad);
+  }
+  printf("  redraw of %u lines with OLED_print: %u bytes\n", CON_LINES, (unsigned)MODEL_bytes);
+  MODEL_check("screen correct after each logged line", !bad);
+  MODEL_check("logged line is one data transaction plus the start line command",
+              last == 1 + 1 + OLED_WIDTH + 3);
+  return MODEL_fails != 0;
+}
@@ -0,0 +1,107 @@
+// ===================================================================================
+// Host Test: OLED Autodetection
+// ===================================================================================
+// Puts an SSD1306 or SH1106 at OLED_ADDR, OLED_ADDR_ALT or nowhere on the bus, runs
+// OLED_init() and draws a test screen (display list, strip renderer, text). The
+// screen must match the one drawn on an SSD1306 at OLED_ADDR, and no window command
+// may reach an SH1106. Built with OLED_AUTODETECT 1 and 2 by 'make host-test'.
+
+#include <stdio.h>
+#include <string.h>
+#include "oled_model.h"
+#include "ssd1306_strip.h"
+
+#define SCREEN_SIZE   (OLED_WIDTH * OLED_HEIGHT / 8)
+
+const uint8_t LIST[] = {
+  OLED_DL_WINDOW(10, 4, 1, 2), OLED_DL_RLE(8), 0x01, 0x0F, 0xF0, 0x83, 0x77,
+  OLED_DL_NEXT,
+  OLED_DL_WINDOW(100, 3, 3, 1), OLED_DL_RLE(3), 0x80, 0x5A,
+  OLED_DL_END
+};
+
+const STRIP_OBJ OBJECTS[] = {
+  STRIP_TEXT(0, 8, "AUTO"), STRIP_FILL(60, 12, 20, 10), STRIP_INVERT(70, 0, 30, 32)
+};
+
+// Test cases: device on the bus and expected result
+typedef struct {
+  uint8_t addr, sh1106, status;               // device (addr 0: none)
+  uint8_t found, addrExp, sh1106Exp;          // expected detection
+} CASE;
+
+const CASE CASES[] = {
+  #if OLED_AUTODETECT == 1
+  { 0x3C, 0, 0x43, 1, 0x3C, 0 },
+  { 0x3C, 0, 0x06, 1, 0x3C, 0 },
+  { 0x3D, 0, 0x43, 1, 0x3D, 0 },
+  { 0x3D, 0, 0x07, 1, 0x3D, 0 },
+  { 0x3C, 1, 0x40, 1, 0x3C, 1 },
+  { 0x3D, 1, 0x40, 1, 0x3D, 1 },
+  { 0x3D, 1, 0x08, 1, 0x3D, 1 },
+  #else
+  { 0x3C, 0, 0x43, 1, 0x3C, 0 },
+  { 0x3D, 0, 0x43, 1, 0x3D, 0 },
+  { 0x3D, 0, 0x40, 1, 0x3D, 0 },              // status not read in mode 2
+  #endif
+  { 0x00, 0, 0x43, 0, 0x3C, 0 }
+};
+
+#define CASES_NUM     (sizeof(CASES) / sizeof(CASE))
+
+uint8_t ref[SCREEN_SIZE], scr[SCREEN_SIZE];
+
+// Draw test screen, return 0 if OLED_init() found no OLED
+uint8_t draw(void) {
+  if(!OLED_init()) return 0;
+  OLED_clear();
+  OLED_clearHidden();
+  OLED_drawList(LIST);
+  STRIP_render(OBJECTS, sizeof(OBJECTS) / sizeof(STRIP_OBJ));
+  OLED_drawList(LIST);
+  OLED_cursor(20, 3);
+  OLED_print("98.8MHz");
+  return 1;
+}
+
+int main(void) {
+  const CASE* c;
+  uint8_t  i, found, hidden, p, x, ok;
+  uint32_t bits;
+  char     what[80];
+
+  printf("autodetection (OLED_AUTODETECT %u):\n", OLED_AUTODETECT);
+  MODEL_fill(0xA5);
+  draw();
+  MODEL_grab(ref);
+
+  for(i=0; i<CASES_NUM; i++) {
+    c = &CASES[i];
+    MODEL_addr = c->addr; MODEL_sh1106 = c->sh1106; MODEL_status = c->status;
+    OLED_addr = OLED_ADDR; OLED_sh1106 = OLED_SH1106;
+    MODEL_fill(0xA5);
+    MODEL_reset();
+    found = OLED_detect();
+    bits  = MODEL_bits;
+    OLED_addr = OLED_ADDR; OLED_sh1106 = OLED_SH1106;
+    MODEL_reset();
+    ok = (draw() == found) && (found == c->found) &&
+         (OLED_addr == c->addrExp) && (OLED_sh1106 == c->sh1106Exp);
+    if(found) {
+      MODEL_grab(scr);
+      hidden = 0;                                 // RAM pages below the screen
+      for(p=OLED_HEIGHT/8; p<8; p++)
+        for(x=0; x<(c->sh1106 ? 132 : 128); x++) hidden |= MODEL_ram[p][x];
+      ok = ok && !memcmp(ref, scr, SCREEN_SIZE) && !hidden && !MODEL_winerr;
+    }
+    else ok = ok && (MODEL_tx == 2) && !MODEL_nacked; // probes only, nothing sent
+    if(c->addr) snprintf(what, sizeof(what), "%s at 0x%02X, status 0x%02X: ",
+                         c->sh1106 ? "SH1106 " : "SSD1306", c->addr, c->status);
+    else        snprintf(what, sizeof(what), "no OLED:                    ");
+    snprintf(what + strlen(what), sizeof(what) - strlen(what), "%s 0x%02X %s, %u bus bits",
+             found ? "found" : "not found,", OLED_addr, OLED_sh1106 ? "SH1106" : "SSD1306",
+             (unsigned)bits);
+    MODEL_check(what, ok);
+  }
+  return MODEL_fails != 0;
+}
@@ -0,0 +1,72 @@
+// ===================================================================================
+// Host Test: Marquee with the SSD1306 Continuous Horizontal Scroll
+// ===================================================================================
+// Checks the command bytes of OLED_marquee() and OLED_marqueeStop(), runs the scroll
+// in the model and compares the page with the rotated label after every step.
+
+#include <stdio.h>
+#include <string.h>
+#include "oled_model.h"
+#include "ssd1306_txt.h"
+
+int main(void) {
+  uint8_t  ref[8][132];
+  uint16_t k, x, bad = 0;
+  uint8_t  other = 1;
+
+  // Expected transactions (control byte and payload)
+  const uint8_t LEFT[]  = { OLED_CMD_MODE, OLED_SCROLL_OFF,
+                            OLED_SCROLL_LEFT,  0x00, 1, OLED_SCROLL_2, 1, 0x00, 0xFF,
+                            OLED_SCROLL_ON };
+  const uint8_t RIGHT[] = { OLED_CMD_MODE, OLED_SCROLL_OFF,
+                            OLED_SCROLL_RIGHT, 0x00, 2, OLED_SCROLL_256, 2, 0x00, 0xFF,
+                            OLED_SCROLL_ON };
+  const uint8_t STOP[]  = { OLED_CMD_MODE, OLED_SCROLL_OFF };
+
+  printf("marquee:\n");
+  MODEL_fill(0xAA);
+  OLED_init();
+  OLED_clear();
+  OLED_cursor(0, 1);
+  OLED_print("RADIO CAMPUS 98.8 FM");
+  memcpy(ref, MODEL_ram, sizeof(ref));
+
+  // Left scroll of line 1, 2 frames per step
+  MODEL_count();
+  OLED_marquee(1, OLED_SCROLL_2, 1);
+  printf("  setup: %u transaction(s), %u bytes\n", (unsigned)MODEL_tx, (unsigned)MODEL_bytes);
+  MODEL_check("left setup bytes", MODEL_lastLen == sizeof(LEFT) && !memcmp(MODEL_last, LEFT, sizeof(LEFT)));
+  MODEL_check("left setup decoded", MODEL_scroll && MODEL_scrollDummy &&
+              MODEL_scrollCmd == OLED_SCROLL_LEFT && MODEL_scrollPage0 == 1 &&
+              MODEL_scrollPage1 == 1 && MODEL_scrollSpeed == OLED_SCROLL_2);
+
+  // 300 steps, only line 1 moves
+  MODEL_count();
+  for(k=1; k<=300; k++) {
+    MODEL_frames(2);
+    for(x=0; x<128; x++) {
+      if(MODEL_ram[1][x] != ref[1][(x + k) & 127]) { bad++; break; }
+      if(MODEL_ram[0][x] != ref[0][x] || MODEL_ram[2][x] != ref[2][x]) other = 0;
+    }
+  }
+  MODEL_check("line 1 rotated left after each of 300 steps", !bad);
+  MODEL_check("other lines unchanged", other);
+  MODEL_check("no bus bytes while scrolling", MODEL_bytes == 0);
+
+  // Right scroll of line 2, 256 frames per step
+  OLED_marquee(2, OLED_SCROLL_256, 0);
+  MODEL_check("right setup bytes", MODEL_lastLen == sizeof(RIGHT) && !memcmp(MODEL_last, RIGHT, sizeof(RIGHT)));
+  memcpy(ref, MODEL_ram, sizeof(ref));
+  MODEL_frames(255);
+  MODEL_check("no step before 256 frames", !memcmp(ref, MODEL_ram, sizeof(ref)));
+  MODEL_frames(1);
+  MODEL_check("line 2 rotated right after 256 frames",
+              MODEL_ram[2][0] == ref[2][127] && !memcmp(&MODEL_ram[2][1], &ref[2][0], 127));
+
+  // Stop
+  OLED_marqueeStop();
+  MODEL_check("stop bytes", MODEL_lastLen == sizeof(STOP) && !memcmp(MODEL_last, STOP, sizeof(STOP)));
+  MODEL_check("scroll stopped", !MODEL_scroll);
+  MODEL_check("no RAM writes while scrolling", MODEL_scrollWrites == 0);
+  return MODEL_fails != 0;
+}
@@ -0,0 +1,89 @@
+// ===================================================================================
+// Host Test: Settings Menu
+// ===================================================================================
+// Runs a key sequence through a menu like the one in main.c. After every key the
+// screen is compared with a full page redraw and the bytes of the step are printed.
+
+#include <stdio.h>
+#include <string.h>
+#include "oled_model.h"
+#include "menu.h"
+
+extern uint8_t MENU_sel, MENU_top, MENU_edit;
+void MENU_drawPage(void);
+
+uint8_t region = 1, mute, contrast = 3, timeout;
+uint8_t applied;
+void apply(void) { applied++; }
+
+const char* const OFFON[]   = { "off", "on" };
+const char* const REGION[]  = { "US", "EU" };
+const char* const TIMEOUT[] = { "off", "10s", "30s", "60s" };
+
+const MENU_ITEM MENU[] = {
+  { "Region",   &region,   1, REGION,  apply },
+  { "Mute",     &mute,     1, OFFON,   apply },
+  { "Contrast", &contrast, 7, 0,       apply },
+  { "Timeout",  &timeout,  3, TIMEOUT, apply },
+  MENU_EXIT("Exit")
+};
+
+// Key sequence
+typedef struct {
+  const char* name;
+  uint8_t key, repeat;
+} STEP;
+
+const STEP STEPS[] = {
+  { "move selection",      MENU_DOWN, 1 },
+  { "start edit",          MENU_OK,   1 },
+  { "change value",        MENU_UP,   1 },
+  { "value at its limit",  MENU_UP,   1 },
+  { "end edit",            MENU_OK,   1 },
+  { "move selection",      MENU_DOWN, 1 },
+  { "start edit",          MENU_OK,   1 },
+  { "change value 5x",     MENU_UP,   5 },
+  { "end edit",            MENU_OK,   1 },
+  { "move selection",      MENU_DOWN, 1 },
+  { "scroll page",         MENU_DOWN, 1 },
+  { "move selection 3x",   MENU_UP,   3 },
+  { "scroll page",         MENU_UP,   1 },
+  { "move to exit",        MENU_DOWN, 4 }
+};
+
+#define STEPS_NUM     (sizeof(STEPS) / sizeof(STEP))
+#define SCREEN_SIZE   (OLED_WIDTH * OLED_HEIGHT / 8)
+
+uint8_t scr[SCREEN_SIZE], ref[SCREEN_SIZE];
+
+// Compare screen with a full page redraw
+uint8_t same(void) {
+  MODEL_grab(scr);
+  MENU_drawPage();
+  MODEL_grab(ref);
+  return !memcmp(scr, ref, SCREEN_SIZE);
+}
+
+int main(void) {
+  uint8_t i, n, open = 1, bad = 0;
+
+  printf("menu:\n");
+  MODEL_fill(0xAA);
+  OLED_init();
+  MODEL_count();
+  MENU_open(MENU, sizeof(MENU) / sizeof(MENU_ITEM));
+  printf("  %-20s %4u bytes\n", "open", (unsigned)MODEL_bytes);
+  MODEL_check("page covers the whole screen", same());
+
+  for(i=0; i<STEPS_NUM; i++) {
+    MODEL_count();
+    for(n=STEPS[i].repeat; n; n--) open &= MENU_key(STEPS[i].key);
+    printf("  %-20s %4u bytes\n", STEPS[i].name, (unsigned)MODEL_bytes);
+    if(!same()) bad++;
+  }
+  MODEL_check("every step matches a full page redraw", !bad);
+  MODEL_check("menu stays open", open);
+  MODEL_check("OK on exit closes the menu", !MENU_key(MENU_OK));
+  MODEL_check("values changed and applied", mute == 1 && contrast == 7 && applied == 5);
+  return MODEL_fails != 0;
+}
@@ -0,0 +1,152 @@
+// ===================================================================================
+// Host Test: Main Screens (display lists, boot frame, cell cache, status strip,
+// pixel shift)
+// ===================================================================================
+// Builds the OLED part of main.c (from "OLED Bitmaps" up to the key reading,
+// extracted by 'make host-test') against the model. Every step is compared with a
+// full redraw of the same state on a cleared display and its bus cost is printed.
+
+#include <stdio.h>
+#include <string.h>
+#include "oled_model.h"
+#include "ssd1306_txt.h"
+#include "kt0803.h"
+#include "band.h"
+#include "arith.h"
+
+// Firmware state and hardware used by the OLED part of main.c
+#define STATUS_LINE   1
+#define PIN_KEYS      0
+#undef  ADC_input
+#define ADC_input(p)
+#define ADC_read_VDD() supply
+uint8_t  oled = 1, display = 0, menu = 0, gain = 3, mute = 0, region = KT_EUROPE_AUSTRALIA;
+uint16_t freq = KT_MHZ(98.8);
+uint16_t supply = 3300;                          // supply voltage in mV
+
+#include "main_oled.inc"
+
+// Test steps (state after the step, strip: only STAT_update() as in the main loop)
+typedef struct {
+  const char* name;
+  uint8_t  strip, display, gain, mute, region;
+  uint16_t freq, supply;
+} STEP;
+
+const STEP STEPS[] = {
+  { "boot",              0, 0, 3, 0, 1, KT_MHZ(98.8),  3300 },
+  { "OK -> gain",        0, 1, 3, 0, 1, KT_MHZ(98.8),  3300 },
+  { "OK -> frequency",   0, 0, 3, 0, 1, KT_MHZ(98.8),  3300 },
+  { "98.8 -> 98.9 MHz",  0, 0, 3, 0, 1, KT_MHZ(98.9),  3300 },
+  { "98.9 -> 99.0 MHz",  0, 0, 3, 0, 1, KT_MHZ(99.0),  3300 },
+  { "99.0 -> 99.05 MHz", 0, 0, 3, 0, 1, KT_MHZ(99.05), 3300 },
+  { "99.05 -> 99.1 MHz", 0, 0, 3, 0, 1, KT_MHZ(99.1),  3300 },
+  { "OK -> gain",        0, 1, 3, 0, 1, KT_MHZ(99.1),  3300 },
+  { "gain 3 -> 4",       0, 1, 4, 0, 1, KT_MHZ(99.1),  3300 },
+  { "gain 4 -> 5",       0, 1, 5, 0, 1, KT_MHZ(99.1),  3300 },
+  { "gain 5 -> 1",       0, 1, 1, 0, 1, KT_MHZ(99.1),  3300 },
+  { "OK -> frequency",   0, 0, 1, 0, 1, KT_MHZ(99.1),  3300 },
+  { "strip: gain 1 -> 5",1, 0, 5, 0, 1, KT_MHZ(99.1),  3300 },
+  { "strip: mute on",    1, 0, 5, 1, 1, KT_MHZ(99.1),  3300 },
+  { "strip: mute off",   1, 0, 5, 0, 1, KT_MHZ(99.1),  3300 },
+  { "strip: 3.3 -> 3.2V",1, 0, 5, 0, 1, KT_MHZ(99.1),  3240 },
+  { "strip: EU -> US",   1, 0, 5, 0, 0, KT_MHZ(99.1),  3240 },
+  { "nothing changed",   1, 0, 5, 0, 0, KT_MHZ(99.1),  3240 }
+};
+
+#define STEPS_NUM     (sizeof(STEPS) / sizeof(STEP))
+#define SCREEN_SIZE   (OLED_WIDTH * OLED_HEIGHT / 8)
+
+uint8_t REF[STEPS_NUM][SCREEN_SIZE];              // full redraw of each step
+uint8_t scr[SCREEN_SIZE];
+
+// Set firmware state of a step, a new supply voltage is measured at once
+void set(const STEP* s) {
+  display = s->display; gain = s->gain; mute = s->mute; region = s->region;
+  freq = s->freq; supply = s->supply;
+  MODEL_time += STAT_VDD_TIME;
+}
+
+// Forget everything shown and draw the current state on a display filled with val
+void redraw(uint8_t val) {
+  screen = 0;
+  STAT_clear();
+  #if OLED_CACHE > 0
+  OLED_cacheClear(0, OLED_WIDTH);
+  #endif
+  MODEL_fill(val);
+  OLED_update();
+  MODEL_grab(scr);
+}
+
+int main(void) {
+  uint8_t i, y, ok, pos, bad = 0;
+  uint8_t x;
+  const uint8_t SHIFT[] = { 1, 0, 63 };
+
+  printf("screens (OLED_CACHE %u):\n", OLED_CACHE);
+  OLED_init();
+
+  // Reference screens, drawn from scratch
+  for(i=0; i<STEPS_NUM; i++) {
+    set(&STEPS[i]);
+    redraw(0x00);
+    memcpy(REF[i], scr, SCREEN_SIZE);
+    redraw(0xFF);
+    if(memcmp(REF[i], scr, SCREEN_SIZE)) {
+      printf("  %s:\n", STEPS[i].name);
+      MODEL_check("full redraw covers the whole screen", 0);
+    }
+  }
+
+  // Boot as in main(): init with display off, first frame, display on
+  screen = 0;
+  STAT_clear();
+  MODEL_reset();
+  MODEL_fill(0xAA);                               // random content after power-up
+  OLED_init();
+  set(&STEPS[0]);
+  #if OLED_CACHE > 0
+  OLED_cacheClear(0, OLED_WIDTH);
+  #endif
+  OLED_update();
+  ok = !MODEL_on;
+  OLED_display(1);
+  MODEL_grab(scr);
+  printf("  boot: %u transactions, %u bytes, %.1f ms, display on after %.1f ms\n",
+    (unsigned)MODEL_tx, (unsigned)MODEL_bytes, MODEL_ms(MODEL_bits), MODEL_ms(MODEL_onBits));
+  MODEL_check("display stays off during the first frame", ok);
+  MODEL_check("first frame matches a full redraw", !memcmp(REF[0], scr, SCREEN_SIZE));
+
+  // Partial updates
+  for(i=1; i<STEPS_NUM; i++) {
+    set(&STEPS[i]);
+    MODEL_count();
+    if(STEPS[i].strip) STAT_update();
+    else               OLED_update();
+    MODEL_grab(scr);
+    printf("  %-20s %3u transactions, %4u bytes, %5.1f ms\n", STEPS[i].name,
+      (unsigned)MODEL_tx, (unsigned)MODEL_bytes, MODEL_ms(MODEL_bits));
+    if(memcmp(REF[i], scr, SCREEN_SIZE)) bad++;
+  }
+  MODEL_check("every partial update matches a full redraw", !bad);
+  MODEL_check("nothing sent when nothing changed", MODEL_bytes == 0);
+
+  // Pixel shift with the display start line
+  OLED_clearHidden();
+  memcpy(REF[0], scr, SCREEN_SIZE);
+  for(i=0; i<sizeof(SHIFT); i++) {
+    MODEL_count();
+    OLED_startline(SHIFT[i]);
+    ok = (MODEL_bytes == 3) && (MODEL_data == 0);
+    for(y=0; y<OLED_HEIGHT; y++) {                // image moves up by SHIFT[i] lines
+      pos = (y + SHIFT[i]) & 63;
+      for(x=0; x<OLED_WIDTH; x++) {
+        if(MODEL_pixel(x, y) != ((pos < OLED_HEIGHT) ? (REF[0][(pos >> 3) * OLED_WIDTH + x] >> (pos & 7)) & 1 : 0)) ok = 0;
+      }
+    }
+    printf("  start line %2u: %u bytes, %u data bytes\n", SHIFT[i], (unsigned)MODEL_bytes, (unsigned)MODEL_data);
+    MODEL_check("image shifted by one line with a blank edge line", ok);
+  }
+  return MODEL_fails != 0;
+}
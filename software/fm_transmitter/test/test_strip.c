@@ -0,0 +1,187 @@
+// ===================================================================================
+// Host Test: Page-Strip Renderer and Graphics Kernels
+// ===================================================================================
+// Renders random object lists and random blit/line/bar calls with STRIP_render()
+// and compares the screen with a reference framebuffer drawn pixel by pixel.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "oled_model.h"
+#include "ssd1306_strip.h"
+#include "ssd1306_gfx.h"
+
+#define RUNS          2000                        // random cases per kind
+
+extern const uint8_t OLED_FONT[];
+
+uint8_t fb[OLED_HEIGHT][OLED_WIDTH];              // reference framebuffer
+uint8_t BMP[8][512], MASK[512];                   // random bitmaps
+
+// Set reference pixel, clipped at the screen border
+void set(int x, int y, uint8_t v) {
+  if(x >= 0 && x < OLED_WIDTH && y >= 0 && y < OLED_HEIGHT) fb[y][x] = v;
+}
+
+// Pixel (x,y) of bitmap with width w
+uint8_t bit(const uint8_t* bmp, int w, int x, int y) {
+  return (bmp[(y >> 3) * w + x] >> (y & 7)) & 1;
+}
+
+// Compare model screen with reference framebuffer
+uint8_t same(void) {
+  uint8_t x, y;
+  for(y=0; y<OLED_HEIGHT; y++)
+    for(x=0; x<OLED_WIDTH; x++) if(MODEL_pixel(x, y) != fb[y][x]) return 0;
+  return 1;
+}
+
+// ===================================================================================
+// Strip Renderer Objects
+// ===================================================================================
+
+// Draw object into reference framebuffer
+void refObject(const STRIP_OBJ* o) {
+  int x, y, c, k;
+  const char* s;
+  for(y=o->y; y<o->y+o->h; y++) {
+    for(x=o->x; x<OLED_WIDTH; x++) {
+      if(o->type != STRIP_TXT && x >= o->x + o->w) break;
+      switch(o->type) {
+        case STRIP_BMP: if(bit(o->data, o->w, x - o->x, y - o->y)) set(x, y, 1); break;
+        case STRIP_SET: set(x, y, 1); break;
+        case STRIP_CLR: set(x, y, 0); break;
+        case STRIP_INV: if(y < OLED_HEIGHT) fb[y][x] ^= 1; break;
+        case STRIP_TXT:                           // 6 columns per character
+          s = o->data; c = (x - o->x) / 6; k = (x - o->x) % 6;
+          if(c >= (int)strlen(s) || o->x + 6 * c > OLED_WIDTH - 6 || !k) break;
+          if((OLED_FONT[(s[c] - 32) * 5 + k - 1] >> (y - o->y)) & 1) set(x, y, 1);
+          break;
+      }
+    }
+  }
+}
+
+// Random object lists
+uint16_t testObjects(void) {
+  const char* TXT[] = { "Hello", "FM 98.8", "ABCDEFGHIJKLMNOPQRSTUVWXYZ" };
+  STRIP_OBJ list[8];
+  uint16_t t, bad = 0;
+  uint8_t i, n;
+  for(t=0; t<RUNS; t++) {
+    n = 1 + rand() % 8;
+    for(i=0; i<n; i++) {
+      list[i].type = rand() % 5;
+      list[i].x = rand() % 140; list[i].y = rand() % 40;
+      list[i].w = 1 + rand() % 80; list[i].h = 1 + rand() % 32;
+      list[i].data = 0;
+      if(list[i].type == STRIP_BMP) list[i].data = BMP[rand() % 8];
+      if(list[i].type == STRIP_TXT) { list[i].data = TXT[rand() % 3]; list[i].w = 0; list[i].h = 8; }
+    }
+    memset(fb, 0, sizeof(fb));
+    for(i=0; i<n; i++) refObject(&list[i]);
+    MODEL_fill(0x55);
+    STRIP_render(list, n);
+    if(!same()) bad++;
+  }
+  return bad;
+}
+
+// ===================================================================================
+// Graphics Kernels (STRIP_CALL)
+// ===================================================================================
+enum { K_BLIT, K_MIRROR, K_INVERT, K_MASKED, K_LINE, K_BAR, K_NUM };
+const char* const KERNEL[] = { "GFX_blit", "GFX_blitMirror", "GFX_blitInvert",
+                               "GFX_blitMasked", "GFX_line", "GFX_bar" };
+int K, X, Y, W, H, X1, Y1, L;                     // current case
+
+// Draw current case into the page buffer
+void draw(void) {
+  switch(K) {
+    case K_BLIT:   GFX_blit(X, Y, W, H, BMP[0]); break;
+    case K_MIRROR: GFX_blitMirror(X, Y, W, H, BMP[0]); break;
+    case K_INVERT: GFX_blitInvert(X, Y, W, H, BMP[0]); break;
+    case K_MASKED: GFX_blitMasked(X, Y, W, H, BMP[0], MASK); break;
+    case K_LINE:   GFX_line(X, Y, X1, Y1); break;
+    case K_BAR:    GFX_bar(X, Y, W, H, L); break;
+  }
+}
+
+// Draw current case into reference framebuffer
+void refKernel(void) {
+  int x, y, dx, dy, sx, sy, e, e2, l;
+  if(K == K_LINE) {                               // Bresenham
+    x = X; y = Y; dx = abs(X1 - X); dy = -abs(Y1 - Y);
+    sx = X < X1 ? 1 : -1; sy = Y < Y1 ? 1 : -1; e = dx + dy;
+    while(1) {
+      set(x, y, 1);
+      if(x == X1 && y == Y1) break;
+      e2 = 2 * e;
+      if(e2 >= dy) { e += dy; x += sx; }
+      if(e2 <= dx) { e += dx; y += sy; }
+    }
+    return;
+  }
+  if(K == K_BAR) {                                // frame and filled bar inside
+    for(x=X; x<X+W; x++) { set(x, Y, 1); set(x, Y + H - 1, 1); }
+    for(y=Y; y<Y+H; y++) { set(X, y, 1); set(X + W - 1, y, 1); }
+    l = (L > W - 4) ? W - 4 : L;
+    for(x=X+2; x<X+2+l; x++) for(y=Y+2; y<Y+H-2; y++) set(x, y, 1);
+    return;
+  }
+  for(y=0; y<H; y++) {
+    for(x=0; x<W; x++) {
+      if(X + x >= OLED_WIDTH || Y + y >= OLED_HEIGHT) continue;
+      switch(K) {
+        case K_BLIT:   if(bit(BMP[0], W, x, y)) fb[Y + y][X + x] = 1; break;
+        case K_MIRROR: if(bit(BMP[0], W, W - 1 - x, y)) fb[Y + y][X + x] = 1; break;
+        case K_INVERT: fb[Y + y][X + x] = !bit(BMP[0], W, x, y); break;
+        case K_MASKED: if(bit(MASK, W, x, y)) fb[Y + y][X + x] = bit(BMP[0], W, x, y); break;
+      }
+    }
+  }
+}
+
+// Random kernel calls on top of a filled and an inverted rectangle
+void testKernels(uint16_t* bad) {
+  const STRIP_OBJ list[] = { STRIP_FILL(10, 5, 50, 20), STRIP_INVERT(30, 0, 80, 17), STRIP_CALL(draw) };
+  uint16_t t, i, x, y;
+  for(t=0; t<RUNS*K_NUM; t++) {
+    K = t % K_NUM;
+    X = rand() % 140; Y = rand() % 40; X1 = rand() % 140; Y1 = rand() % 40; L = rand() % 80;
+    W = (K == K_BAR ? 4 : 1) + rand() % 70; H = (K == K_BAR ? 4 : 1) + rand() % 32;
+    if(K == K_LINE) { X %= OLED_WIDTH; Y %= OLED_HEIGHT; X1 %= OLED_WIDTH; Y1 %= OLED_HEIGHT; }
+    for(i=0; i<512; i++) { BMP[0][i] = rand(); MASK[i] = rand(); }
+    memset(fb, 0, sizeof(fb));
+    for(y=5; y<25; y++) for(x=10; x<60; x++) fb[y][x] = 1;
+    for(y=0; y<17; y++) for(x=30; x<110; x++) fb[y][x] ^= 1;
+    refKernel();
+    STRIP_render(list, 3);
+    if(!same()) bad[K]++;
+  }
+}
+
+int main(void) {
+  const STRIP_OBJ ONE[] = { STRIP_TEXT(0, 0, "x") };
+  uint16_t i, bad[K_NUM] = { 0 };
+  char what[64];
+
+  printf("strip:\n");
+  srand(1);
+  for(i=0; i<sizeof(BMP); i++) BMP[0][i] = rand();
+  OLED_init();
+
+  MODEL_count();
+  STRIP_render(ONE, 1);
+  printf("  frame: %u transactions, %u bytes, %.1f ms\n",
+    (unsigned)MODEL_tx, (unsigned)MODEL_bytes, MODEL_ms(MODEL_bits));
+  snprintf(what, sizeof(what), "%u random object lists match the reference", RUNS);
+  MODEL_check(what, !testObjects());
+
+  testKernels(bad);
+  for(i=0; i<K_NUM; i++) {
+    snprintf(what, sizeof(what), "%-15s %u random cases match the reference", KERNEL[i], RUNS);
+    MODEL_check(what, !bad[i]);
+  }
+  return MODEL_fails != 0;
+}
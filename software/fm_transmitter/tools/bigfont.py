@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+# ===================================================================================
+# Big Font Generator for SSD1306 OLED Text Functions
+# ===================================================================================
+#
+# Generates the 5x16 (v-stretched) and 10x16 (double-sized, smoothed) fonts from the
+# 5x8 OLED_FONT in src/ssd1306_txt.c and writes them to src/ssd1306_bigfont.c. They
+# are used with OLED_BIGCHARS = 2, so that big characters are drawn by copying the
+# table instead of stretching and smoothing them at runtime. The result is identical
+# to the runtime conversion of OLED_BIGCHARS = 1.
+#
+# Usage (from the project folder):
+#   python3 tools/bigfont.py
+#
+# 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+import re
+
+SOURCE = 'src/ssd1306_txt.c'
+TARGET = 'src/ssd1306_bigfont.c'
+
+def read_font():
+  src  = open(SOURCE).read()
+  body = re.search(r'OLED_FONT\[\]\s*=\s*\{(.*?)\}', src, re.S).group(1)
+  return [int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]+', body)]
+
+# Converts bit pattern abcdefgh into aabbccddeeffgghh
+def stretch(x):
+  y = 0
+  for i in range(8):
+    if x & (1 << i): y |= 3 << (2 * i)
+  return y
+
+# 5x16: stretched columns, upper page first
+def char_5x16(cols):
+  s = [stretch(c) for c in cols]
+  return [v & 0xFF for v in s] + [v >> 8 for v in s]
+
+# 10x16: David Johnson-Davies' Smooth Big Text algorithm (as in OLED_plotChar())
+def char_10x16(cols):
+  buf  = [0] * 20
+  col0 = cols[0]
+  col0L = col0R = stretch(col0)
+  for col in range(0, 10, 2):
+    col1 = cols[col // 2 + 1] if col < 8 else 0
+    col1L = col1R = stretch(col1)
+    for i in range(6, -1, -1):
+      for j in (1, 2):
+        if ((col0 >> i) & 3) == 3 - j and ((col1 >> i) & 3) == j:
+          col0R |= 1 << ((i << 1) + j)
+          col1L |= 1 << ((i << 1) + 3 - j)
+    buf[col], buf[col + 1] = col0L & 0xFF, col0R & 0xFF
+    buf[col + 10], buf[col + 11] = col0L >> 8, col0R >> 8
+    col0, col0L, col0R = col1, col1L, col1R
+  return buf
+
+def table(name, chars):
+  lines = ['const uint8_t %s[] = {' % name]
+  for n, data in enumerate(chars):
+    c   = {32: 'space', 92: 'backslash', 127: '0x7F'}.get(n + 32, chr(n + 32))
+    row = ', '.join('0x%02X' % v for v in data)
+    sep = ',' if n < len(chars) - 1 else ' '
+    lines.append('  %s%s // %s' % (row, sep, c))
+  lines.append('};')
+  return '\n'.join(lines)
+
+def main():
+  font  = read_font()
+  chars = [font[i:i + 5] for i in range(0, len(font), 5)]
+  out = """// ===================================================================================
+// SSD1306 OLED Big Fonts (5x16, 10x16) for OLED_BIGCHARS = 2
+// ===================================================================================
+//
+// Generated by tools/bigfont.py from OLED_FONT, do not edit.
+//
+// 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+#include "ssd1306_txt.h"
+
+#if OLED_BIGCHARS == 2
+
+// 5x16 font (chars 32 - 127), 10 bytes per character: upper page, lower page
+%s
+
+// 10x16 smoothed font (chars 32 - 127), 20 bytes per character: upper page, lower page
+%s
+
+#endif  // OLED_BIGCHARS == 2
+""" % (table('OLED_FONT_5X16', [char_5x16(c) for c in chars]),
+       table('OLED_FONT_10X16', [char_10x16(c) for c in chars]))
+  open(TARGET, 'w').write(out)
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+# ===================================================================================
+# Run-Length Encoder for OLED Bitmaps
+# ===================================================================================
+#
+# Compresses byte arrays of a C source file for OLED_drawBitmapRLE(). Each bitmap is
+# a sequence of blocks starting with a control byte:
+#
+#   0x00 - 0x7F   literal block, (control + 1) bytes follow and are copied as is
+#   0x80 - 0xFF   run block, the next byte is repeated (control - 0x80 + 3) times
+#
+# Runs shorter than 3 bytes are stored as literals. Runs may cross the end of a
+# page (8-pixel line), the decoder keeps its state between pages.
+#
+# Usage:
+#   python3 tools/bitmap_rle.py src/main.c OLED_MHZ OLED_DB
+#   python3 tools/bitmap_rle.py src/ssd1306_txt.c OLED_FONT_SEG --split 52
+#
+# --split n compresses every n bytes as a separate bitmap (e.g. one font character
+# of 13x4 bytes) and additionally prints the offset table to access them.
+#
+# If an array only exists in compressed form (ARRAY_RLE, e.g. OLED_MHZ_RLE in
+# src/main.c), it is decoded and encoded again. --raw prints the decoded arrays
+# instead, as a starting point for editing a bitmap:
+#   python3 tools/bitmap_rle.py src/main.c OLED_MHZ --raw
+#
+# 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+import re
+import sys
+
+RUN_MIN = 3                                       # shortest run stored as run block
+RUN_MAX = 0x7F + RUN_MIN                          # longest run block
+LIT_MAX = 0x80                                    # longest literal block
+
+def encode(data):
+  out, lit, i = [], [], 0
+  def flush():
+    while lit:
+      chunk = lit[:LIT_MAX]
+      del lit[:LIT_MAX]
+      out.extend([len(chunk) - 1] + chunk)
+  while i < len(data):
+    n = 1
+    while i + n < len(data) and data[i + n] == data[i] and n < RUN_MAX: n += 1
+    if n >= RUN_MIN:
+      flush()
+      out.extend([0x80 + n - RUN_MIN, data[i]])
+    else:
+      lit.extend(data[i:i + n])
+    i += n
+  flush()
+  return out
+
+def decode(enc):
+  out, i = [], 0
+  while i < len(enc):
+    c = enc[i]
+    if c & 0x80:
+      out.extend([enc[i + 1]] * (c - 0x80 + RUN_MIN)); i += 2
+    else:
+      out.extend(enc[i + 1:i + c + 2]); i += c + 2
+  return out
+
+def read_array(source, name):
+  m = re.search(r'\b' + re.escape(name) + r'\s*\[\s*\]\s*=\s*\{(.*?)\}', source, re.S)
+  if not m: sys.exit('array %s not found' % name)
+  body = re.sub(r'//[^\n]*', '', m.group(1))
+  return [int(v, 0) for v in re.findall(r'0x[0-9A-Fa-f]+|\d+', body)]
+
+def read_bitmap(source, name):
+  if re.search(r'\b' + re.escape(name) + r'\s*\[\s*\]\s*=', source):
+    return read_array(source, name)
+  return decode(read_array(source, name + '_RLE'))  # only the compressed array exists
+
+def print_array(name, data, comment):
+  print('// %s' % comment)
+  print('const uint8_t %s[] = {' % name)
+  for i in range(0, len(data), 16):
+    row = ', '.join('0x%02X' % v for v in data[i:i + 16])
+    print('  ' + row + (',' if i + 16 < len(data) else ''))
+  print('};\n')
+
+def main():
+  args = sys.argv[1:]
+  split = 0
+  raw_out = '--raw' in args
+  if raw_out: args.remove('--raw')
+  if '--split' in args:
+    k = args.index('--split'); split = int(args[k + 1]); del args[k:k + 2]
+  if len(args) < 2: sys.exit('Usage: bitmap_rle.py file.c ARRAY [ARRAY ...] [--split n] [--raw]')
+  source = open(args[0]).read()
+  for name in args[1:]:
+    raw  = read_bitmap(source, name)
+    if raw_out:
+      print_array(name, raw, '%s decoded: %d bytes' % (name, len(raw)))
+      continue
+    size = split or len(raw)
+    enc, offsets = [], []
+    for i in range(0, len(raw), size):
+      offsets.append(len(enc))
+      part = encode(raw[i:i + size])
+      assert decode(part) == raw[i:i + size]
+      enc.extend(part)
+    print_array(name + '_RLE', enc, '%s run-length encoded: %d -> %d bytes' % (name, len(raw), len(enc)))
+    if split:
+      itype = 'uint8_t' if offsets[-1] < 256 else 'uint16_t'
+      print('const %s %s_RLE_IDX[] = { %s };\n' % (itype, name, ', '.join(str(o) for o in offsets)))
+
+if __name__ == '__main__':
+  main()
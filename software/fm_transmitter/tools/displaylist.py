@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+# ===================================================================================
+# Display List Compiler for SSD1306 OLED Text Functions
+# ===================================================================================
+#
+# Compiles static screen layouts into display lists for OLED_drawList() (see
+# ssd1306_txt.h). Each rectangle of a layout becomes one I2C transaction: the
+# window header OLED_DL_WINDOW(x,w,y,h) followed by the run-length encoded data
+# (see bitmap_rle.py) of all its columns, page by page.
+#
+# A layout is given on the command line as the name of the list followed by its
+# rectangles and their content from left to right:
+#
+#   @x,y,h        start a rectangle at column x, page y with a height of h pages
+#   _n            n blank columns
+#   ARRAY/w       bitmap array of the C source file, w pixels wide, h pages high
+#                 (arrays ending in _RLE are decoded first)
+#   :text         text in the 5x8 font of src/ssd1306_txt.c (h must be 1)
+#
+# Several lists can be compiled at once. The width of a rectangle is the sum of the
+# widths of its content.
+#
+# Usage:
+#   python3 tools/displaylist.py src/main.c \
+#     OLED_DL_FREQ @70,0,4 _13 OLED_MHZ_RLE/44 _1 \
+#     OLED_DL_FINE @86,0,3 _42 @86,3,1 _24 :MHz
+#
+# 2023 by Stefan Wagner:   https://github.com/wagiminator
+
+import sys
+from bitmap_rle import encode, decode, read_array
+
+FONT = 'src/ssd1306_txt.c'
+
+def text(s):
+  font = read_array(open(FONT).read(), 'OLED_FONT')
+  out  = []
+  for c in s:
+    p = (ord(c) - 32) * 5
+    out.extend([0x00] + font[p:p + 5])            # space between characters first
+  return out
+
+def compile_list(source, name, items):
+  body, raw, tx = [], 0, 0
+  rect = None
+  def close():
+    nonlocal raw, tx
+    if not rect: return
+    x, y, h, cols = rect
+    w = len(cols)
+    data = [cols[c][p] for p in range(h) for c in range(w)]
+    enc = encode(data)
+    assert decode(enc) == data
+    if tx: body.append(['OLED_DL_NEXT'])
+    body.append(['OLED_DL_WINDOW(%3d, %3d, %d, %d)' % (x, w, y, h), 'OLED_DL_RLE(%d)' % len(data)])
+    body.append(['0x%02X' % v for v in enc])
+    raw += len(data); tx += 1
+  for item in items:
+    if item.startswith('@'):
+      close()
+      x, y, h = (int(v) for v in item[1:].split(','))
+      rect = (x, y, h, [])
+      continue
+    if not rect: sys.exit('%s: rectangle (@x,y,h) expected before %s' % (name, item))
+    h, cols = rect[2], rect[3]
+    if item.startswith('_'):
+      cols.extend([[0x00] * h for i in range(int(item[1:]))])
+    elif item.startswith(':'):
+      if h != 1: sys.exit('%s: text needs a height of 1 page' % name)
+      cols.extend([[v] for v in text(item[1:])])
+    else:
+      array, w = item.split('/')
+      w   = int(w)
+      bmp = read_array(source, array)
+      if array.endswith('_RLE'): bmp = decode(bmp)
+      if len(bmp) != w * h: sys.exit('%s: %s is not %dx%d' % (name, array, w, h * 8))
+      cols.extend([[bmp[p * w + c] for p in range(h)] for c in range(w)])
+  close()
+  size = sum(len(row) for row in body if row[0].startswith('0x')) + 18 * tx
+  print('// %s: %d transaction(s), %d data bytes -> %d bytes' % (name, tx, raw, size))
+  print('const uint8_t %s[] = {' % name)
+  for row in body:
+    for i in range(0, len(row), 16):
+      print('  ' + ', '.join(row[i:i + 16]) + ',')
+  print('  OLED_DL_END')
+  print('};\n')
+
+def main():
+  args = sys.argv[1:]
+  if len(args) < 3: sys.exit('Usage: displaylist.py file.c NAME @x,y,h ITEM [ITEM ...] [NAME ...]')
+  source = open(args[0]).read()
+  lists  = []
+  for arg in args[1:]:
+    if arg[0] in '@_:' or '/' in arg: lists[-1][1].append(arg)
+    else: lists.append((arg, []))
+  for name, items in lists: compile_list(source, name, items)
+
+if __name__ == '__main__':
+  main()